@@ -36,6 +36,8 @@
 #include "Gameboy/GbTypes.h"
 #include "PCE/Debugger/PceDebugger.h"
 #include "PCE/PceTypes.h"
+#include "PCE/PceConsole.h"
+#include "Shared/CdSectorCache.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/Audio/SoundMixer.h"
@@ -810,6 +812,15 @@ void Debugger::GetConsoleState(BaseState& state, ConsoleType consoleType)
 	_console->GetConsoleState(state, consoleType);
 }
 
+CdSectorCacheStats Debugger::GetCdSectorCacheStats()
+{
+	//Host-side read cache statistics for CD-based consoles (not part of the emulated state)
+	if(PceConsole* console = dynamic_cast<PceConsole*>(_console)) {
+		return console->GetCdSectorCacheStats();
+	}
+	return {};
+}
+
 DebuggerFeatures Debugger::GetDebuggerFeatures(CpuType cpuType)
 {
 	if(_debuggers[(int)cpuType].Debugger) {
@@ -39,6 +39,7 @@ class FrozenAddressManager;
 
 struct TraceRow;
 struct BaseState;
+struct CdSectorCacheStats;
 
 enum class EventType;
 enum class MemoryOperationType;
@@ -151,6 +152,7 @@ public:
 	void SetPpuState(BaseState& srcState, CpuType cpuType);
 
 	void GetConsoleState(BaseState& state, ConsoleType consoleType);
+	CdSectorCacheStats GetCdSectorCacheStats();
 
 	DebuggerFeatures GetDebuggerFeatures(CpuType cpuType);
 	uint32_t GetProgramCounter(CpuType cpuType, bool forInstStart);
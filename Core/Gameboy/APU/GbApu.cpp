@@ -69,6 +69,26 @@ uint64_t GbApu::GetElapsedApuCycles()
 	return _gameboy->GetApuCycleCount() - _powerOnCycle;
 }
 
+int16_t GbApu::GetLeftOutput(GameboyConfig& cfg)
+{
+	return (
+		(_square1->GetOutput() & (int8_t)_state.EnableLeftSq1) * (int32_t)cfg.Square1Vol / 100 +
+		(_square2->GetOutput() & (int8_t)_state.EnableLeftSq2) * (int32_t)cfg.Square2Vol / 100 +
+		(_wave->GetOutput() & (int8_t)_state.EnableLeftWave) * (int32_t)cfg.WaveVol / 100 +
+		(_noise->GetOutput() & (int8_t)_state.EnableLeftNoise) * (int32_t)cfg.NoiseVol / 100
+	) * (_state.LeftVolume + 1) * 40;
+}
+
+int16_t GbApu::GetRightOutput(GameboyConfig& cfg)
+{
+	return (
+		(_square1->GetOutput() & (int8_t)_state.EnableRightSq1) * (int32_t)cfg.Square1Vol / 100 +
+		(_square2->GetOutput() & (int8_t)_state.EnableRightSq2) * (int32_t)cfg.Square2Vol / 100 +
+		(_wave->GetOutput() & (int8_t)_state.EnableRightWave) * (int32_t)cfg.WaveVol / 100 +
+		(_noise->GetOutput() & (int8_t)_state.EnableRightNoise) * (int32_t)cfg.NoiseVol / 100
+	) * (_state.RightVolume + 1) * 40;
+}
+
 void GbApu::Run()
 {
 	uint64_t clockCount = _gameboy->GetApuCycleCount();
@@ -76,10 +96,12 @@ void GbApu::Run()
 	_prevClockCount = clockCount;
 
 	GameboyConfig cfg = _settings->GetGameboyConfig();
+	bool skipSynthesis = _soundMixer->IsSynthesisSkipped();
 
 	if(!_state.ApuEnabled) {
 		_clockCounter += clocksToRun;
 	} else {
+		bool ranChannels = clocksToRun > 0;
 		while(clocksToRun > 0) {
 			uint32_t minTimer = std::min<uint32_t>({ clocksToRun, _square1->GetState().Timer, _square2->GetState().Timer, _wave->GetState().Timer, _noise->GetState().Timer });
 
@@ -91,30 +113,28 @@ void GbApu::Run()
 
 			_clockCounter += minTimer;
 
-			int16_t leftOutput = (
-				(_square1->GetOutput() & (int8_t)_state.EnableLeftSq1) * (int32_t)cfg.Square1Vol / 100 +
-				(_square2->GetOutput() & (int8_t)_state.EnableLeftSq2) * (int32_t)cfg.Square2Vol / 100 +
-				(_wave->GetOutput() & (int8_t)_state.EnableLeftWave) * (int32_t)cfg.WaveVol / 100 +
-				(_noise->GetOutput() & (int8_t)_state.EnableLeftNoise) * (int32_t)cfg.NoiseVol / 100
-				) * (_state.LeftVolume + 1) * 40;
+			if(skipSynthesis) {
+				continue;
+			}
 
+			int16_t leftOutput = GetLeftOutput(cfg);
 			if(_prevLeftOutput != leftOutput) {
 				blip_add_delta(_leftChannel, _clockCounter, leftOutput - _prevLeftOutput);
 				_prevLeftOutput = leftOutput;
 			}
 
-			int16_t rightOutput = (
-				(_square1->GetOutput() & (int8_t)_state.EnableRightSq1) * (int32_t)cfg.Square1Vol / 100 +
-				(_square2->GetOutput() & (int8_t)_state.EnableRightSq2) * (int32_t)cfg.Square2Vol / 100 +
-				(_wave->GetOutput() & (int8_t)_state.EnableRightWave) * (int32_t)cfg.WaveVol / 100 +
-				(_noise->GetOutput() & (int8_t)_state.EnableRightNoise) * (int32_t)cfg.NoiseVol / 100
-				) * (_state.RightVolume + 1) * 40;
-
+			int16_t rightOutput = GetRightOutput(cfg);
 			if(_prevRightOutput != rightOutput) {
 				blip_add_delta(_rightChannel, _clockCounter, rightOutput - _prevRightOutput);
 				_prevRightOutput = rightOutput;
 			}
 		}
+
+		if(skipSynthesis && ranChannels) {
+			//Keep the last output values in sync (they are part of save states), without generating any samples
+			_prevLeftOutput = GetLeftOutput(cfg);
+			_prevRightOutput = GetRightOutput(cfg);
+		}
 	}
 
 	if(!_gameboy->IsSgb() && _clockCounter >= 20000) {
@@ -10,6 +10,7 @@ class Emulator;
 class Gameboy;
 class SoundMixer;
 class EmuSettings;
+struct GameboyConfig;
 
 class GbApu : public ISerializable
 {
@@ -45,6 +46,9 @@ private:
 
 	uint8_t InternalRead(uint16_t addr);
 
+	__forceinline int16_t GetLeftOutput(GameboyConfig& cfg);
+	__forceinline int16_t GetRightOutput(GameboyConfig& cfg);
+
 public:
 	GbApu();
 	virtual ~GbApu();
@@ -91,6 +91,7 @@ void GbPpu::Exec()
 			//More than a full frame's worth of time has passed since the last frame, send another blank frame
 			_lastFrameTime = _gameboy->GetApuCycleCount();
 			_isFirstFrame = true;
+			ProcessFrameSkip();
 			SendFrame();
 		}
 		return;
@@ -197,6 +198,7 @@ void GbPpu::ProcessVblankScanline()
 				_state.Ly = 0;
 				_state.LyForCompare = 0;
 				_wyEnableFlag = false;
+				ProcessFrameSkip();
 
 				if(_emu->IsDebugging()) {
 					_emu->ProcessEvent(EventType::StartFrame, CpuType::Gameboy);
@@ -367,7 +369,7 @@ void GbPpu::RunDrawCycle()
 	}
 
 	if(_fetchSprite == -1 && _bgFifo.Size > 0) {
-		if(_drawnPixels >= 0) {
+		if(_drawnPixels >= 0 && !_skipRender) {
 			GameboyConfig& cfg = _emu->GetSettings()->GetGameboyConfig();
 
 			GbFifoEntry entry = _bgFifo.Content[_bgFifo.Position];
@@ -678,14 +680,25 @@ void GbPpu::SendFrame()
 	}
 	_isFirstFrame = false;
 
-	RenderedFrame frame(_currentBuffer, GbConstants::ScreenWidth, GbConstants::ScreenHeight, 1.0, _state.FrameCount, _gameboy->GetControlManager()->GetPortStates());
-	bool rewinding = _emu->GetRewindManager()->IsRewinding();
-	_emu->GetVideoDecoder()->UpdateFrame(frame, rewinding, rewinding);
+	if(!_skipRender) {
+		RenderedFrame frame(_currentBuffer, GbConstants::ScreenWidth, GbConstants::ScreenHeight, 1.0, _state.FrameCount, _gameboy->GetControlManager()->GetPortStates());
+		bool rewinding = _emu->GetRewindManager()->IsRewinding();
+		_emu->GetVideoDecoder()->UpdateFrame(frame, rewinding, rewinding);
+	}
 
 	_emu->ProcessEndOfFrame();
 	_gameboy->ProcessEndOfFrame();
 
-	_currentBuffer = _currentBuffer == _outputBuffers[0] ? _outputBuffers[1] : _outputBuffers[0];
+	if(!_skipRender) {
+		_currentBuffer = _currentBuffer == _outputBuffers[0] ? _outputBuffers[1] : _outputBuffers[0];
+	}
+}
+
+void GbPpu::ProcessFrameSkip()
+{
+	//The SGB uses the pixels written by the PPU to build its own frame, and the debugger tools read the current buffer
+	bool allowSkip = !_emu->GetSettings()->GetGameboyConfig().DisableFrameSkipping && !_emu->IsDebugging() && !_gameboy->IsSgb();
+	_skipRender = _frameSkip.ProcessStartFrame(_emu, allowSkip);
 }
 
 void GbPpu::DebugSendFrame()
@@ -787,6 +800,7 @@ void GbPpu::Write(uint16_t addr, uint8_t value)
 					ResetRenderer();
 					_state.LyCoincidenceFlag = _state.LyCompare == _state.LyForCompare;
 					UpdateStatIrq();
+					ProcessFrameSkip();
 					
 					if(_emu->IsDebugging()) {
 						_emu->ProcessEvent(EventType::StartFrame, CpuType::Gameboy);
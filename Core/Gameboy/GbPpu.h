@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "Gameboy/GbTypes.h"
 #include "Utilities/ISerializable.h"
+#include "Shared/Video/FrameSkipHelper.h"
 
 class Emulator;
 class Gameboy;
@@ -52,6 +53,9 @@ private:
 	bool _isFirstFrame = true;
 	bool _rendererIdle = false;
 
+	FrameSkipHelper _frameSkip;
+	bool _skipRender = false;
+
 	__forceinline void WriteBgPixel(uint8_t colorIndex);
 	__forceinline void WriteObjPixel(uint8_t colorIndex);
 
@@ -73,6 +77,7 @@ private:
 	void UpdateStatIrq();
 
 	void SendFrame();
+	void ProcessFrameSkip();
 	void UpdatePalette();
 
 	uint8_t ReadCgbPalette(uint8_t& pos, uint16_t* pal);
@@ -168,6 +168,8 @@ void BaseMapper::SetCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, uint8
 
 		sourceOffset += 0x100;
 	}
+
+	UpdateDirectPages(startAddr << 8, (endAddr << 8) | 0xFF);
 }
 
 void BaseMapper::RemoveCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr)
@@ -508,6 +510,7 @@ void BaseMapper::AddRegisterRange(uint16_t startAddr, uint16_t endAddr, MemoryOp
 			_isWriteRegisterAddr[i] = true;
 		}
 	}
+	UpdateRegisterPages(startAddr, endAddr);
 }
 
 void BaseMapper::RemoveRegisterRange(uint16_t startAddr, uint16_t endAddr, MemoryOperation operation)
@@ -520,6 +523,30 @@ void BaseMapper::RemoveRegisterRange(uint16_t startAddr, uint16_t endAddr, Memor
 			_isWriteRegisterAddr[i] = false;
 		}
 	}
+	UpdateRegisterPages(startAddr, endAddr);
+}
+
+void BaseMapper::UpdateRegisterPages(uint16_t startAddr, uint16_t endAddr)
+{
+	for(int page = startAddr >> 8; page <= (endAddr >> 8); page++) {
+		_isReadRegisterPage[page] = false;
+		_isWriteRegisterPage[page] = false;
+		for(int i = page << 8, end = i + 0x100; i < end; i++) {
+			_isReadRegisterPage[page] |= _isReadRegisterAddr[i];
+			_isWriteRegisterPage[page] |= _isWriteRegisterAddr[i];
+		}
+	}
+	UpdateDirectPages(startAddr & 0xFF00, endAddr | 0xFF);
+}
+
+void BaseMapper::UpdateDirectPages(uint16_t startAddr, uint16_t endAddr)
+{
+	//Let the memory manager know which pages can be accessed without calling ReadRam/WriteRam
+	//(the memory manager doesn't exist yet while the mapper is being initialized, it refreshes all pages once the mapper is registered)
+	NesMemoryManager* memoryManager = _console ? _console->GetMemoryManager() : nullptr;
+	if(memoryManager) {
+		memoryManager->UpdateDirectPages(startAddr >> 8, endAddr >> 8);
+	}
 }
 
 void BaseMapper::Serialize(Serializer& s)
@@ -594,6 +621,8 @@ void BaseMapper::Initialize(NesConsole* console, RomData& romData)
 
 	memset(_isReadRegisterAddr, 0, sizeof(_isReadRegisterAddr));
 	memset(_isWriteRegisterAddr, 0, sizeof(_isWriteRegisterAddr));
+	memset(_isReadRegisterPage, 0, sizeof(_isReadRegisterPage));
+	memset(_isWriteRegisterPage, 0, sizeof(_isWriteRegisterPage));
 	AddRegisterRange(RegisterStartAddress(), RegisterEndAddress(), MemoryOperation::Any);
 
 	_prgSize = (uint32_t)romData.PrgRom.size();
@@ -856,6 +885,22 @@ void BaseMapper::WritePrgRam(uint16_t addr, uint8_t value)
 	}
 }
 
+uint8_t* BaseMapper::GetDirectReadPage(uint8_t page)
+{
+	if((_allowRegisterRead && _isReadRegisterPage[page]) || !(_prgMemoryAccess[page] & MemoryAccessType::Read)) {
+		return nullptr;
+	}
+	return _prgPages[page];
+}
+
+uint8_t* BaseMapper::GetDirectWritePage(uint8_t page)
+{
+	if(_isWriteRegisterPage[page] || !(_prgMemoryAccess[page] & MemoryAccessType::Write)) {
+		return nullptr;
+	}
+	return _prgPages[page];
+}
+
 void BaseMapper::NotifyVramAddressChange(uint16_t addr)
 {
 	//This is called when the VRAM addr on the PPU memory bus changes
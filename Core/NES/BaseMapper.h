@@ -25,6 +25,8 @@ private:
 	uint16_t InternalGetChrRomPageSize();
 	uint16_t InternalGetChrRamPageSize();
 	bool ValidateAddressRange(uint16_t startAddr, uint16_t endAddr);
+	void UpdateRegisterPages(uint16_t startAddr, uint16_t endAddr);
+	void UpdateDirectPages(uint16_t startAddr, uint16_t endAddr);
 
 	uint8_t *_nametableRam = nullptr;
 	uint8_t _nametableCount = 2;
@@ -37,6 +39,8 @@ private:
 	bool _allowRegisterRead = false;
 	bool _isReadRegisterAddr[0x10000] = {};
 	bool _isWriteRegisterAddr[0x10000] = {};
+	bool _isReadRegisterPage[0x100] = {};
+	bool _isWriteRegisterPage[0x100] = {};
 
 	MemoryAccessType _prgMemoryAccess[0x100] = {};
 	uint8_t* _prgPages[0x100] = {};
@@ -189,6 +193,9 @@ public:
 	void DebugWriteRam(uint16_t addr, uint8_t value);
 	void WritePrgRam(uint16_t addr, uint8_t value);
 
+	uint8_t* GetDirectReadPage(uint8_t page) override;
+	uint8_t* GetDirectWritePage(uint8_t page) override;
+
 	virtual uint8_t MapperReadVram(uint16_t addr, MemoryOperationType operationType);
 	
 	__forceinline uint8_t ReadVram(uint16_t addr, MemoryOperationType type = MemoryOperationType::PpuRenderingRead)
@@ -3,6 +3,7 @@
 #include "NES/INesMemoryHandler.h"
 #include "Utilities/ISerializable.h"
 #include "NES/NesTypes.h"
+#include "Shared/Video/FrameSkipHelper.h"
 
 enum class ConsoleRegion;
 
@@ -114,6 +115,9 @@ protected:
 
 	uint64_t _oamDecayCycles[0x40] = {};
 	bool _corruptOamRow[32] = {};
+
+	FrameSkipHelper _frameSkip;
+	bool _skipRender = false;
 	
 	bool IsRenderingEnabled();
 	void UpdateGrayscaleAndIntensifyBits();
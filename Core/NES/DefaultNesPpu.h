@@ -13,6 +13,7 @@ public:
 	__forceinline void StoreTileInformation() {}
 	__forceinline bool RemoveSpriteLimit() { return _console->GetNesConfig().RemoveSpriteLimit; }
 	__forceinline bool UseAdaptiveSpriteLimit() { return _console->GetNesConfig().AdaptiveSpriteLimit; }
+	__forceinline bool AllowFrameSkip() { return true; }
 
 	void* OnBeforeSendFrame() { return nullptr; }
 
@@ -23,6 +24,14 @@ public:
 
 	__forceinline void DrawPixel()
 	{
+		if(_skipRender) {
+			//This frame won't be displayed, only the sprite 0 hit detection done by GetPixelColor is needed
+			if(_hasSprite[_cycle] && _sprite0Visible && !_statusFlags.Sprite0Hit && (IsRenderingEnabled() || ((_videoRamAddr & 0x3F00) != 0x3F00))) {
+				GetPixelColor();
+			}
+			return;
+		}
+
 		//This is called 3.7 million times per second - needs to be as fast as possible.
 		if(IsRenderingEnabled() || ((_videoRamAddr & 0x3F00) != 0x3F00)) {
 			uint32_t color = GetPixelColor();
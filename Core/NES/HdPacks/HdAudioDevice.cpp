@@ -5,6 +5,7 @@
 #include "NES/NesConsole.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Utilities/Serializer.h"
 
@@ -21,6 +22,17 @@ HdAudioDevice::HdAudioDevice(Emulator* emu, HdPackData* hdData)
 	_oggMixer.reset(new OggMixer());
 	_oggMixer->SetBgmVolume(_bgmVolume);
 	_oggMixer->SetSfxVolume(_sfxVolume);
+
+	//Decode the pack's sound effects in the background, so they don't need to be decoded while mixing
+	_oggMixer->SetSfxCacheSize((size_t)_emu->GetSettings()->GetNesConfig().HdPackSfxCacheSize * 1024 * 1024);
+	vector<string> sfxFiles;
+	for(auto& sfx : _hdData->SfxFilesById) {
+		sfxFiles.push_back(sfx.second);
+	}
+	std::sort(sfxFiles.begin(), sfxFiles.end());
+	sfxFiles.erase(std::unique(sfxFiles.begin(), sfxFiles.end()), sfxFiles.end());
+	_oggMixer->PreloadSfx(sfxFiles);
+
 	_emu->GetSoundMixer()->RegisterAudioProvider(_oggMixer.get());
 }
 
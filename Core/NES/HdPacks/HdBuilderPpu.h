@@ -53,6 +53,8 @@ public:
 		ProcessScanlineImpl();
 	}
 
+	__forceinline bool AllowFrameSkip() { return false; }
+
 	void DrawPixel()
 	{
 		if(IsRenderingEnabled() || ((_videoRamAddr & 0x3F00) != 0x3F00)) {
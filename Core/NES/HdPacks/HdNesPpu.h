@@ -70,6 +70,8 @@ public:
 		ProcessScanlineImpl();
 	}
 
+	__forceinline bool AllowFrameSkip() { return false; }
+
 	void DrawPixel()
 	{
 		uint16_t bufferOffset = (_scanline << 8) + _cycle - 1;
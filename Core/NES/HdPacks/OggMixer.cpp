@@ -11,12 +11,24 @@ enum class OggPlaybackOptions
 
 OggMixer::OggMixer()
 {
+	_stopDecodeThread = false;
+	_decodeThread = std::thread(&OggMixer::DecodeThread, this);
+}
+
+OggMixer::~OggMixer()
+{
+	_stopDecodeThread = true;
+	_decodeSignal.Signal();
+	_decodeThread.join();
 }
 
 void OggMixer::Reset(uint32_t sampleRate)
 {
-	_bgm.reset();
-	_sfx.clear();
+	{
+		auto lock = _lock.AcquireSafe();
+		_bgm.reset();
+		_sfx.clear();
+	}
 	_sfxVolume = 128;
 	_bgmVolume = 128;
 	_options = 0;
@@ -41,11 +53,13 @@ void OggMixer::SetPausedFlag(bool paused)
 
 void OggMixer::StopBgm()
 {
+	auto lock = _lock.AcquireSafe();
 	_bgm.reset();
 }
 
 void OggMixer::StopSfx()
 {
+	auto lock = _lock.AcquireSafe();
 	_sfx.clear();
 }
 
@@ -83,18 +97,121 @@ void OggMixer::SetSampleRate(int sampleRate)
 bool OggMixer::Play(string filename, bool isSfx, uint32_t startOffset, uint32_t loopPosition)
 {
 	shared_ptr<OggReader> reader(new OggReader());
+	if(isSfx) {
+		shared_ptr<OggDecodedData> cachedData;
+		{
+			auto lock = _lock.AcquireSafe();
+			auto result = _sfxCache.find(filename);
+			if(result != _sfxCache.end()) {
+				cachedData = result->second;
+			} else if(_sfxCacheFailed.find(filename) == _sfxCacheFailed.end() && std::find(_sfxToPreload.begin(), _sfxToPreload.end(), filename) == _sfxToPreload.end()) {
+				//Stream it this time, and cache it for the next time it's played
+				_sfxToPreload.push_back(filename);
+			}
+		}
+
+		if(cachedData) {
+			reader->Init(cachedData, _sampleRate);
+			auto lock = _lock.AcquireSafe();
+			_sfx.push_back(reader);
+			return true;
+		}
+	}
+
 	bool loop = !isSfx && (_options & (int)OggPlaybackOptions::Loop) != 0;
 	if(reader->Init(filename, loop, _sampleRate, startOffset, loopPosition)) {
-		if(isSfx) {
-			_sfx.push_back(reader);
-		} else {
-			_bgm = reader;
+		{
+			auto lock = _lock.AcquireSafe();
+			if(isSfx) {
+				_sfx.push_back(reader);
+			} else {
+				_bgm = reader;
+			}
 		}
+		_decodeSignal.Signal();
 		return true;
 	}
 	return false;
 }
 
+void OggMixer::SetSfxCacheSize(size_t maxSize)
+{
+	auto lock = _lock.AcquireSafe();
+	_sfxCacheMaxSize = maxSize;
+}
+
+void OggMixer::PreloadSfx(const vector<string>& filenames)
+{
+	{
+		auto lock = _lock.AcquireSafe();
+		//The queue is processed from the end, so add them in reverse order
+		for(auto it = filenames.rbegin(); it != filenames.rend(); it++) {
+			if(std::find(_sfxToPreload.begin(), _sfxToPreload.end(), *it) == _sfxToPreload.end()) {
+				_sfxToPreload.insert(_sfxToPreload.begin(), *it);
+			}
+		}
+	}
+	_decodeSignal.Signal();
+}
+
+void OggMixer::DecodeThread()
+{
+	vector<shared_ptr<OggReader>> readers;
+	while(!_stopDecodeThread) {
+		_decodeSignal.Wait(10);
+
+		{
+			auto lock = _lock.AcquireSafe();
+			readers = _sfx;
+			if(_bgm) {
+				readers.push_back(_bgm);
+			}
+		}
+
+		for(shared_ptr<OggReader>& reader : readers) {
+			reader->FillBuffer();
+		}
+		readers.clear();
+
+		if(!_stopDecodeThread) {
+			PreloadNextSfx();
+		}
+	}
+}
+
+void OggMixer::PreloadNextSfx()
+{
+	string filename;
+	size_t availableSize;
+	{
+		auto lock = _lock.AcquireSafe();
+		if(_sfxToPreload.empty()) {
+			return;
+		}
+
+		//Sound effects that were just played (added at the end) are loaded before the rest of the pack
+		filename = _sfxToPreload.back();
+		_sfxToPreload.pop_back();
+		availableSize = _sfxCacheMaxSize - std::min(_sfxCacheSize, _sfxCacheMaxSize);
+	}
+
+	//Decode one file at a time, so streamed tracks get refilled in between
+	shared_ptr<OggDecodedData> data = OggReader::DecodeFile(filename, availableSize);
+
+	auto lock = _lock.AcquireSafe();
+	if(data) {
+		_sfxCache[filename] = data;
+		_sfxCacheSize += data->Samples.size() * sizeof(int16_t);
+	} else {
+		//Invalid file or over the cache limit, keep streaming it
+		_sfxCacheFailed.insert(filename);
+	}
+
+	if(!_sfxToPreload.empty()) {
+		_decodeSignal.Signal();
+	}
+}
+
 int OggMixer::GetBgmOffset()
 {
 	if(_bgm) {
@@ -106,10 +223,12 @@ int OggMixer::GetBgmOffset()
 
 void OggMixer::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate)
 {
+	//The decode thread has already decoded the samples, this only needs to resample and mix them
 	if(_bgm && !_paused) {
 		_bgm->SetSampleRate(sampleRate);
 		_bgm->ApplySamples(out, sampleCount, _bgmVolume);
 		if(_bgm->IsPlaybackOver()) {
+			auto lock = _lock.AcquireSafe();
 			_bgm.reset();
 		}
 	}
@@ -117,5 +236,11 @@ void OggMixer::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate)
 		sfx->SetSampleRate(sampleRate);
 		sfx->ApplySamples(out, sampleCount, _sfxVolume);
 	}
-	_sfx.erase(std::remove_if(_sfx.begin(), _sfx.end(), [](const shared_ptr<OggReader>& o) { return o->IsPlaybackOver(); }), _sfx.end());
+
+	{
+		auto lock = _lock.AcquireSafe();
+		_sfx.erase(std::remove_if(_sfx.begin(), _sfx.end(), [](const shared_ptr<OggReader>& o) { return o->IsPlaybackOver(); }), _sfx.end());
+	}
+
+	_decodeSignal.Signal();
 }
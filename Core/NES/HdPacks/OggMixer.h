@@ -1,8 +1,12 @@
 #pragma once
 #include "pch.h"
+#include <thread>
 #include "Shared/Interfaces/IAudioProvider.h"
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
 
 class OggReader;
+struct OggDecodedData;
 
 class OggMixer : public IAudioProvider
 {
@@ -16,9 +20,26 @@ private:
 	uint8_t _options = 0;
 	bool _paused = false;
 
+	//Decodes streamed tracks ahead of the mixer, and preloads sound effects into the cache
+	std::thread _decodeThread;
+	AutoResetEvent _decodeSignal;
+	atomic<bool> _stopDecodeThread;
+
+	//Held when _bgm/_sfx are modified (they are only modified on the emulation thread), and to access the cache
+	SimpleLock _lock;
+
+	unordered_map<string, shared_ptr<OggDecodedData>> _sfxCache;
+	unordered_set<string> _sfxCacheFailed;
+	vector<string> _sfxToPreload;
+	size_t _sfxCacheSize = 0;
+	size_t _sfxCacheMaxSize = 0;
+
+	void DecodeThread();
+	void PreloadNextSfx();
+
 public:
 	OggMixer();
-	virtual ~OggMixer() = default;
+	virtual ~OggMixer();
 
 	void SetSampleRate(int sampleRate);
 	
@@ -34,5 +55,9 @@ public:
 	bool IsSfxPlaying();
 	int32_t GetBgmOffset();
 
+	//Sound effects are decoded on the decode thread and kept in memory, up to maxSize bytes
+	void SetSfxCacheSize(size_t maxSize);
+	void PreloadSfx(const vector<string>& filenames);
+
 	void MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate) override;
 };
@@ -5,6 +5,8 @@
 OggReader::OggReader()
 {
 	_done = false;
+	_loop = false;
+	_decoderAtEnd = false;
 	_oggBuffer = new int16_t[10000];
 	_outputBuffer = new int16_t[2000];
 }
@@ -28,22 +30,68 @@ bool OggReader::Init(string filename, bool loop, uint32_t sampleRate, uint32_t s
 		_vorbis = stb_vorbis_open_memory(_fileData.data(), (int)_fileData.size(), &error, nullptr);
 		if(_vorbis) {
 			_loop = loop;
+			_streamLength = stb_vorbis_stream_length_in_samples(_vorbis);
 			if(loopPosition > 0) {
-				unsigned int sampleCount = stb_vorbis_stream_length_in_samples(_vorbis);
-				_loopPosition = loopPosition < sampleCount ? loopPosition : 0;
+				_loopPosition = loopPosition < _streamLength ? loopPosition : 0;
 			} else {
 				_loopPosition = 0;
 			}
 			_oggSampleRate = stb_vorbis_get_info(_vorbis).sample_rate;
-			if(startOffset > 0) {
-				stb_vorbis_seek(_vorbis, startOffset);
+			if(startOffset > 0 && stb_vorbis_seek(_vorbis, startOffset)) {
+				_decodePosition = startOffset;
 			}
+			_decodedSamples.Resize(OggReader::BufferedFrameCount * 4, 4);
 			return true;
 		}
 	}
 	return false;
 }
 
+void OggReader::Init(shared_ptr<OggDecodedData> data, uint32_t sampleRate)
+{
+	_cachedData = data;
+	_cachedPosition = 0;
+	_oggSampleRate = data->SampleRate;
+	_loop = false;
+}
+
+shared_ptr<OggDecodedData> OggReader::DecodeFile(string filename, size_t maxSize)
+{
+	int error;
+	vector<uint8_t> fileData;
+	VirtualFile file = filename;
+	if(!file.ReadFile(fileData)) {
+		return nullptr;
+	}
+
+	stb_vorbis* vorbis = stb_vorbis_open_memory(fileData.data(), (int)fileData.size(), &error, nullptr);
+	if(!vorbis) {
+		return nullptr;
+	}
+
+	shared_ptr<OggDecodedData> data;
+	size_t frameCount = stb_vorbis_stream_length_in_samples(vorbis);
+	if(frameCount > 0 && frameCount * 4 <= maxSize) {
+		data.reset(new OggDecodedData());
+		data->SampleRate = stb_vorbis_get_info(vorbis).sample_rate;
+		data->Samples.resize(frameCount * 2);
+
+		//Use the same API as streamed playback (it converts mono files to stereo)
+		size_t framesDecoded = 0;
+		while(framesDecoded < frameCount) {
+			int frames = stb_vorbis_get_samples_short_interleaved(vorbis, 2, data->Samples.data() + framesDecoded * 2, (int)(frameCount - framesDecoded) * 2);
+			if(frames <= 0) {
+				break;
+			}
+			framesDecoded += frames;
+		}
+		data->Samples.resize(framesDecoded * 2);
+	}
+
+	stb_vorbis_close(vorbis);
+	return data;
+}
+
 bool OggReader::IsPlaybackOver()
 {
 	return _done;
@@ -61,25 +109,90 @@ void OggReader::SetLoopFlag(bool loop)
 	_loop = loop;
 }
 
+uint32_t OggReader::Decode(int16_t* out, uint32_t frameCount)
+{
+	uint32_t framesDecoded = 0;
+	bool looped = false;
+	while(framesDecoded < frameCount) {
+		int frames = stb_vorbis_get_samples_short_interleaved(_vorbis, 2, out + framesDecoded * 2, (frameCount - framesDecoded) * 2);
+		if(frames > 0) {
+			framesDecoded += frames;
+			_decodePosition += frames;
+			_framesSinceLoop += frames;
+			looped = false;
+		} else if(_loop && !looped) {
+			stb_vorbis_seek(_vorbis, _loopPosition);
+			_decodePosition = _loopPosition;
+			_framesSinceLoop = 0;
+			looped = true;
+		} else {
+			break;
+		}
+	}
+
+	_decoderAtEnd = framesDecoded < frameCount;
+	return framesDecoded;
+}
+
+void OggReader::FillBuffer()
+{
+	if(!_vorbis) {
+		return;
+	}
+
+	int16_t chunk[OggReader::DecodeChunkFrameCount * 2];
+	while(true) {
+		//Lock for each chunk so the mixer never has to wait long if it runs out of samples
+		auto lock = _decodeLock.AcquireSafe();
+		uint32_t freeFrames = (_decodedSamples.GetSize() - _decodedSamples.GetFillLevel()) / 4;
+		if(freeFrames < OggReader::DecodeChunkFrameCount) {
+			break;
+		}
+
+		uint32_t frames = Decode(chunk, OggReader::DecodeChunkFrameCount);
+		_decodedSamples.Write((uint8_t*)chunk, frames * 4);
+		if(frames < OggReader::DecodeChunkFrameCount) {
+			break;
+		}
+	}
+}
+
+uint32_t OggReader::ReadSamples(int16_t* out, uint32_t frameCount)
+{
+	if(_cachedData) {
+		uint32_t frames = std::min<uint32_t>(frameCount, (uint32_t)(_cachedData->Samples.size() / 2) - _cachedPosition);
+		memcpy(out, _cachedData->Samples.data() + _cachedPosition * 2, frames * 4);
+		_cachedPosition += frames;
+		return frames;
+	}
+
+	uint32_t framesRead = _decodedSamples.Read((uint8_t*)out, frameCount * 4) / 4;
+	if(framesRead < frameCount) {
+		//The decode thread hasn't caught up (e.g the track just started), decode the rest here.
+		//Once the lock is held, the decode thread can't add more samples, so the order is preserved
+		auto lock = _decodeLock.AcquireSafe();
+		framesRead += _decodedSamples.Read((uint8_t*)(out + framesRead * 2), (frameCount - framesRead) * 4) / 4;
+		if(framesRead < frameCount) {
+			framesRead += Decode(out + framesRead * 2, frameCount - framesRead);
+		}
+	}
+	return framesRead;
+}
+
 void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume)
 {
 	int32_t samplesNeeded = (int32_t)sampleCount - _resampler.GetPendingCount();
 	uint32_t samplesRead = 0;
 	if(samplesNeeded > 0) {
 		uint32_t samplesToLoad = samplesNeeded * _oggSampleRate / _sampleRate + 2;
-		uint32_t samplesLoaded = (uint32_t)stb_vorbis_get_samples_short_interleaved(_vorbis, 2, _oggBuffer, samplesToLoad * 2);
+		uint32_t samplesLoaded = ReadSamples(_oggBuffer, samplesToLoad);
 		if(samplesLoaded < samplesToLoad) {
-			if(_loop) {
-				stb_vorbis_seek(_vorbis, _loopPosition);
-				samplesLoaded += stb_vorbis_get_samples_short_interleaved(_vorbis, 2, _oggBuffer + samplesLoaded * 2, samplesToLoad - samplesLoaded);
-			} else {
-				_done = true;
-			}
+			_done = true;
 		}
 		_resampler.SetSampleRates(_oggSampleRate, _sampleRate);
 		samplesRead = _resampler.Resample<false>(_oggBuffer, samplesLoaded, _outputBuffer, sampleCount);
 	}
-	
+
 	uint32_t samplesToProcess = (uint32_t)samplesRead * 2;
 	for(uint32_t i = 0; i < samplesToProcess; i++) {
 		buffer[i] = std::clamp<int32_t>((int32_t)(_outputBuffer[i] * volume / 255) + buffer[i], INT16_MIN, INT16_MAX);
@@ -88,5 +201,18 @@ void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume
 
 uint32_t OggReader::GetOffset()
 {
-	return stb_vorbis_get_file_offset(_vorbis);
-}
\ No newline at end of file
+	if(!_vorbis) {
+		return 0;
+	}
+
+	//Position (in samples) of the next sample the mixer will read - the decoder itself is ahead of this
+	auto lock = _decodeLock.AcquireSafe();
+	uint32_t bufferedFrames = _decodedSamples.GetFillLevel() / 4;
+	if(bufferedFrames <= _framesSinceLoop) {
+		return _decodePosition - bufferedFrames;
+	} else {
+		//The decoder looped back after the samples that are still buffered
+		uint32_t framesBeforeLoop = bufferedFrames - _framesSinceLoop;
+		return _streamLength > framesBeforeLoop ? _streamLength - framesBeforeLoop : 0;
+	}
+}
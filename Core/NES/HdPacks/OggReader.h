@@ -1,37 +1,72 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/VirtualFile.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/SpscRingBuffer.h"
 #include "Utilities/Audio/HermiteResampler.h"
 
 struct stb_vorbis;
 
+//A fully decoded file (16-bit stereo), shared by all readers that play it
+struct OggDecodedData
+{
+	vector<int16_t> Samples;
+	int SampleRate = 0;
+};
+
 class OggReader
 {
 private:
+	static constexpr uint32_t BufferedFrameCount = 16384; //~370ms at 44.1kHz
+	static constexpr uint32_t DecodeChunkFrameCount = 1024;
+
 	stb_vorbis* _vorbis = nullptr;
 	int16_t* _outputBuffer = nullptr;
 	int16_t* _oggBuffer = nullptr;
 
 	HermiteResampler _resampler;
 
-	bool _loop = false;
+	atomic<bool> _loop;
 	bool _done = false;
-	
+
 	uint32_t _loopPosition = 0;
+	uint32_t _streamLength = 0;
 
 	int _sampleRate = 0;
 	int _oggSampleRate = 0;
 
 	vector<uint8_t> _fileData;
 
+	//Streamed playback: the decode thread keeps the ring buffer filled ahead of the mixer
+	//_decodeLock must be held to use the decoder (_vorbis) and the fields below
+	SpscRingBuffer _decodedSamples;
+	SimpleLock _decodeLock;
+	atomic<bool> _decoderAtEnd;
+	uint32_t _decodePosition = 0;
+	uint32_t _framesSinceLoop = 0;
+
+	//Cached playback: the whole file was decoded ahead of time
+	shared_ptr<OggDecodedData> _cachedData;
+	uint32_t _cachedPosition = 0;
+
+	uint32_t Decode(int16_t* out, uint32_t frameCount);
+	uint32_t ReadSamples(int16_t* out, uint32_t frameCount);
+
 public:
 	OggReader();
 	~OggReader();
 
 	bool Init(string filename, bool loop, uint32_t sampleRate, uint32_t startOffset = 0, uint32_t loopPosition = 0);
+	void Init(shared_ptr<OggDecodedData> data, uint32_t sampleRate);
 	bool IsPlaybackOver();
 	void SetSampleRate(int sampleRate);
 	void SetLoopFlag(bool loop);
 	void ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume);
 	uint32_t GetOffset();
+
+	//Called by the decode thread to refill the ring buffer
+	void FillBuffer();
+
+	//Decodes an entire file, returns nullptr if it fails or if the decoded data would be larger than maxSize (in bytes)
+	static shared_ptr<OggDecodedData> DecodeFile(string filename, size_t maxSize);
 };
@@ -52,5 +52,10 @@ public:
 	virtual void WriteRam(uint16_t addr, uint8_t value) = 0;
 	virtual uint8_t PeekRam(uint16_t addr) { return 0; }
 
+	//Returns a pointer to a 256-byte page's memory when it can be read (or written) directly, without side effects
+	//Used by NesMemoryManager to bypass ReadRam/WriteRam for internal RAM, PRG ROM and PRG RAM
+	virtual uint8_t* GetDirectReadPage(uint8_t page) { return nullptr; }
+	virtual uint8_t* GetDirectWritePage(uint8_t page) { return nullptr; }
+
 	virtual ~INesMemoryHandler() {}
 };
\ No newline at end of file
@@ -34,4 +34,14 @@ public:
 	{
 		_internalRam[addr & Mask] = value;
 	}
+
+	uint8_t* GetDirectReadPage(uint8_t page) override
+	{
+		return _internalRam + ((page << 8) & Mask);
+	}
+
+	uint8_t* GetDirectWritePage(uint8_t page) override
+	{
+		return _internalRam + ((page << 8) & Mask);
+	}
 };
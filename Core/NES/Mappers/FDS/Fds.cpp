@@ -206,6 +206,12 @@ uint8_t Fds::ReadRam(uint16_t addr)
 	return BaseMapper::ReadRam(addr);
 }
 
+uint8_t* Fds::GetDirectReadPage(uint8_t page)
+{
+	//ReadRam watches for reads to $E18C and $E445 (game start/disk checks)
+	return page == 0xE1 || page == 0xE4 ? nullptr : BaseMapper::GetDirectReadPage(page);
+}
+
 void Fds::ProcessAutoDiskInsert()
 {
 	if(IsAutoInsertDiskEnabled()) {
@@ -109,6 +109,7 @@ protected:
 	uint8_t ReadRegister(uint16_t addr) override;
 
 	uint8_t ReadRam(uint16_t addr) override;
+	uint8_t* GetDirectReadPage(uint8_t page) override;
 
 	void Serialize(Serializer& s) override;
 	vector<MapperStateEntry> GetMapperStateEntries() override;
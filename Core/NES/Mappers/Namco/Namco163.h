@@ -162,6 +162,12 @@ protected:
 		BaseMapper::WriteRam(addr, value);
 	}
 
+	uint8_t* GetDirectWritePage(uint8_t page) override
+	{
+		//Writes to $6000-$7FFF are used to detect the variant
+		return page >= 0x60 && page <= 0x7F ? nullptr : BaseMapper::GetDirectWritePage(page);
+	}
+
 	uint8_t ReadRegister(uint16_t addr) override
 	{
 		switch(addr & 0xF800) {
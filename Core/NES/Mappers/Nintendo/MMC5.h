@@ -427,6 +427,12 @@ protected:
 		BaseMapper::WriteRam(addr, value);
 	}
 
+	uint8_t* GetDirectWritePage(uint8_t page) override
+	{
+		//Expansion RAM writes must go through WriteRam
+		return page >= 0x5C && page <= 0x5F ? nullptr : BaseMapper::GetDirectWritePage(page);
+	}
+
 	void DetectScanlineStart(uint16_t addr)
 	{
 		if(_ntReadCounter >= 2) {
@@ -100,6 +100,12 @@ protected:
 		BaseMapper::WriteRam(addr, value);
 	}
 
+	uint8_t* GetDirectWritePage(uint8_t page) override
+	{
+		//Writes to $6000-$7FFF reset the licensing timer
+		return page >= 0x60 && page <= 0x7F ? nullptr : BaseMapper::GetDirectWritePage(page);
+	}
+
 	void WriteRegister(uint16_t addr, uint8_t value) override
 	{
 		switch(addr & 0xF000) {
@@ -20,50 +20,6 @@ NesCpu::NesCpu(NesConsole* console)
 	_console = console;
 	_memoryManager = _console->GetMemoryManager();
 
-	Func opTable[] = { 
-	//	0					1					2					3					4					5					6							7					8					9					A							B					C							D					E							F
-		&NesCpu::BRK,	&NesCpu::ORA,	&NesCpu::HLT,	&NesCpu::SLO,	&NesCpu::NOP,	&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO,	&NesCpu::PHP,	&NesCpu::ORA,	&NesCpu::ASL_Acc,		&NesCpu::AAC,	&NesCpu::NOP,			&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO, //0
-		&NesCpu::BPL,	&NesCpu::ORA,	&NesCpu::HLT,	&NesCpu::SLO,	&NesCpu::NOP,	&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO,	&NesCpu::CLC,	&NesCpu::ORA,	&NesCpu::NOP,			&NesCpu::SLO,	&NesCpu::NOP,			&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO, //1
-		&NesCpu::JSR,	&NesCpu::AND,	&NesCpu::HLT,	&NesCpu::RLA,	&NesCpu::BIT,	&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA,	&NesCpu::PLP,	&NesCpu::AND,	&NesCpu::ROL_Acc,		&NesCpu::AAC,	&NesCpu::BIT,			&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA, //2
-		&NesCpu::BMI,	&NesCpu::AND,	&NesCpu::HLT,	&NesCpu::RLA,	&NesCpu::NOP,	&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA,	&NesCpu::SEC,	&NesCpu::AND,	&NesCpu::NOP,			&NesCpu::RLA,	&NesCpu::NOP,			&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA, //3
-		&NesCpu::RTI,	&NesCpu::EOR,	&NesCpu::HLT,	&NesCpu::SRE,	&NesCpu::NOP,	&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE,	&NesCpu::PHA,	&NesCpu::EOR,	&NesCpu::LSR_Acc,		&NesCpu::ASR,	&NesCpu::JMP_Abs,		&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE, //4
-		&NesCpu::BVC,	&NesCpu::EOR,	&NesCpu::HLT,	&NesCpu::SRE,	&NesCpu::NOP,	&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE,	&NesCpu::CLI,	&NesCpu::EOR,	&NesCpu::NOP,			&NesCpu::SRE,	&NesCpu::NOP,			&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE, //5
-		&NesCpu::RTS,	&NesCpu::ADC,	&NesCpu::HLT,	&NesCpu::RRA,	&NesCpu::NOP,	&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA,	&NesCpu::PLA,	&NesCpu::ADC,	&NesCpu::ROR_Acc,		&NesCpu::ARR,	&NesCpu::JMP_Ind,		&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA, //6
-		&NesCpu::BVS,	&NesCpu::ADC,	&NesCpu::HLT,	&NesCpu::RRA,	&NesCpu::NOP,	&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA,	&NesCpu::SEI,	&NesCpu::ADC,	&NesCpu::NOP,			&NesCpu::RRA,	&NesCpu::NOP,			&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA, //7
-		&NesCpu::NOP,	&NesCpu::STA,	&NesCpu::NOP,	&NesCpu::SAX,	&NesCpu::STY,	&NesCpu::STA,	&NesCpu::STX,			&NesCpu::SAX,	&NesCpu::DEY,	&NesCpu::NOP,	&NesCpu::TXA,			&NesCpu::UNK,	&NesCpu::STY,			&NesCpu::STA,	&NesCpu::STX,			&NesCpu::SAX, //8
-		&NesCpu::BCC,	&NesCpu::STA,	&NesCpu::HLT,	&NesCpu::AXA,	&NesCpu::STY,	&NesCpu::STA,	&NesCpu::STX,			&NesCpu::SAX,	&NesCpu::TYA,	&NesCpu::STA,	&NesCpu::TXS,			&NesCpu::TAS,	&NesCpu::SYA,			&NesCpu::STA,	&NesCpu::SXA,			&NesCpu::AXA, //9
-		&NesCpu::LDY,	&NesCpu::LDA,	&NesCpu::LDX,	&NesCpu::LAX,	&NesCpu::LDY,	&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX,	&NesCpu::TAY,	&NesCpu::LDA,	&NesCpu::TAX,			&NesCpu::ATX,	&NesCpu::LDY,			&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX, //A
-		&NesCpu::BCS,	&NesCpu::LDA,	&NesCpu::HLT,	&NesCpu::LAX,	&NesCpu::LDY,	&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX,	&NesCpu::CLV,	&NesCpu::LDA,	&NesCpu::TSX,			&NesCpu::LAS,	&NesCpu::LDY,			&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX, //B
-		&NesCpu::CPY,	&NesCpu::CPA,	&NesCpu::NOP,	&NesCpu::DCP,	&NesCpu::CPY,	&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP,	&NesCpu::INY,	&NesCpu::CPA,	&NesCpu::DEX,			&NesCpu::AXS,	&NesCpu::CPY,			&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP, //C
-		&NesCpu::BNE,	&NesCpu::CPA,	&NesCpu::HLT,	&NesCpu::DCP,	&NesCpu::NOP,	&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP,	&NesCpu::CLD,	&NesCpu::CPA,	&NesCpu::NOP,			&NesCpu::DCP,	&NesCpu::NOP,			&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP, //D
-		&NesCpu::CPX,	&NesCpu::SBC,	&NesCpu::NOP,	&NesCpu::ISB,	&NesCpu::CPX,	&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB,	&NesCpu::INX,	&NesCpu::SBC,	&NesCpu::NOP,			&NesCpu::SBC,	&NesCpu::CPX,			&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB, //E
-		&NesCpu::BEQ,	&NesCpu::SBC,	&NesCpu::HLT,	&NesCpu::ISB,	&NesCpu::NOP,	&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB,	&NesCpu::SED,	&NesCpu::SBC,	&NesCpu::NOP,			&NesCpu::ISB,	&NesCpu::NOP,			&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB  //F
-	};
-
-	typedef NesAddrMode M;
-	NesAddrMode addrMode[] = {
-	//	0			1				2			3				4				5				6				7				8			9			A			B			C			D			E			F
-		M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//0
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//1
-		M::Abs,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//2
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//3
-		M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//4
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//5
-		M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Ind,	M::Abs,	M::Abs,	M::Abs,	//6
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//7
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//8
-		M::Rel,	M::IndYW,	M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroY,	M::ZeroY,	M::Imp,	M::AbsYW,M::Imp,	M::AbsYW,M::AbsXW,M::AbsXW,M::AbsYW,M::AbsYW,//9
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//A
-		M::Rel,	M::IndY,		M::None,	M::IndY,		M::ZeroX,	M::ZeroX,	M::ZeroY,	M::ZeroY,	M::Imp,	M::AbsY,	M::Imp,	M::AbsY,	M::AbsX,	M::AbsX,	M::AbsY,	M::AbsY,	//B
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//C
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//D
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//E
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//F
-	};
-	
-	memcpy(_opTable, opTable, sizeof(opTable));
-	memcpy(_addrMode, addrMode, sizeof(addrMode));
-
 	_instAddrMode = NesAddrMode::None;
 	_state = {};
 	_operand = 0;
@@ -169,10 +125,7 @@ void NesCpu::Exec()
 	_emu->ProcessInstruction<CpuType::Nes>();
 #endif
 
-	uint8_t opCode = GetOPCode();
-	_instAddrMode = _addrMode[opCode];
-	_operand = FetchOperand();
-	(this->*_opTable[opCode])();
+	RunOp(GetOPCode());
 	
 	if(_prevRunIrq || _prevNeedNmi) {
 		IRQ();
@@ -261,28 +214,34 @@ uint8_t NesCpu::MemoryRead(uint16_t addr, MemoryOperationType operationType)
 #endif
 }
 
-uint16_t NesCpu::FetchOperand()
+template<NesAddrMode mode>
+void NesCpu::AddrMode()
 {
-	switch(_instAddrMode) {
+	//The addressing mode is a template parameter, so each opcode's case in RunOp only contains the code for its own mode
+	_instAddrMode = mode;
+	switch(mode) {
 		case NesAddrMode::Acc:
-		case NesAddrMode::Imp: DummyRead(); return 0;
+		case NesAddrMode::Imp: DummyRead(); _operand = 0; break;
 		case NesAddrMode::Imm:
-		case NesAddrMode::Rel: return GetImmediate();
-		case NesAddrMode::Zero: return GetZeroAddr();
-		case NesAddrMode::ZeroX: return GetZeroXAddr();
-		case NesAddrMode::ZeroY: return GetZeroYAddr();
-		case NesAddrMode::Ind: return GetIndAddr();
-		case NesAddrMode::IndX: return GetIndXAddr();
-		case NesAddrMode::IndY: return GetIndYAddr(false);
-		case NesAddrMode::IndYW: return GetIndYAddr(true);
-		case NesAddrMode::Abs: return GetAbsAddr();
-		case NesAddrMode::AbsX: return GetAbsXAddr(false);
-		case NesAddrMode::AbsXW: return GetAbsXAddr(true);
-		case NesAddrMode::AbsY: return GetAbsYAddr(false);
-		case NesAddrMode::AbsYW: return GetAbsYAddr(true);
-		default: break;
+		case NesAddrMode::Rel: _operand = GetImmediate(); break;
+		case NesAddrMode::Zero: _operand = GetZeroAddr(); break;
+		case NesAddrMode::ZeroX: _operand = GetZeroXAddr(); break;
+		case NesAddrMode::ZeroY: _operand = GetZeroYAddr(); break;
+		case NesAddrMode::Ind: _operand = GetIndAddr(); break;
+		case NesAddrMode::IndX: _operand = GetIndXAddr(); break;
+		case NesAddrMode::IndY: _operand = GetIndYAddr(false); break;
+		case NesAddrMode::IndYW: _operand = GetIndYAddr(true); break;
+		case NesAddrMode::Abs: _operand = GetAbsAddr(); break;
+		case NesAddrMode::AbsX: _operand = GetAbsXAddr(false); break;
+		case NesAddrMode::AbsXW: _operand = GetAbsXAddr(true); break;
+		case NesAddrMode::AbsY: _operand = GetAbsYAddr(false); break;
+		case NesAddrMode::AbsYW: _operand = GetAbsYAddr(true); break;
+		default: ProcessCpuCrash(); _operand = 0; break;
 	}
-	
+}
+
+void NesCpu::ProcessCpuCrash()
+{
 #if !defined(DUMMYCPU)
 	if(_lastCrashWarning == 0 || _state.CycleCount - _lastCrashWarning > 5000000) {
 		MessageManager::DisplayMessage("Error", "GameCrash", "Invalid OP code - CPU crashed.");
@@ -295,13 +254,271 @@ uint16_t NesCpu::FetchOperand()
 		//For NSF files, reset cpu if it ever crashes
 		_emu->Reset();
 	}
-	
-	return 0;
-#else 
-	return 0;
 #endif
 }
 
+void NesCpu::RunOp(uint8_t opCode)
+{
+	switch(opCode) {
+		case 0x00: AddrMode<NesAddrMode::Imp>(); BRK(); break;
+		case 0x01: AddrMode<NesAddrMode::IndX>(); ORA(); break;
+		case 0x02: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x03: AddrMode<NesAddrMode::IndX>(); SLO(); break;
+		case 0x04: AddrMode<NesAddrMode::Zero>(); NOP(); break;
+		case 0x05: AddrMode<NesAddrMode::Zero>(); ORA(); break;
+		case 0x06: AddrMode<NesAddrMode::Zero>(); ASL_Memory(); break;
+		case 0x07: AddrMode<NesAddrMode::Zero>(); SLO(); break;
+		case 0x08: AddrMode<NesAddrMode::Imp>(); PHP(); break;
+		case 0x09: AddrMode<NesAddrMode::Imm>(); ORA(); break;
+		case 0x0A: AddrMode<NesAddrMode::Acc>(); ASL_Acc(); break;
+		case 0x0B: AddrMode<NesAddrMode::Imm>(); AAC(); break;
+		case 0x0C: AddrMode<NesAddrMode::Abs>(); NOP(); break;
+		case 0x0D: AddrMode<NesAddrMode::Abs>(); ORA(); break;
+		case 0x0E: AddrMode<NesAddrMode::Abs>(); ASL_Memory(); break;
+		case 0x0F: AddrMode<NesAddrMode::Abs>(); SLO(); break;
+		case 0x10: AddrMode<NesAddrMode::Rel>(); BPL(); break;
+		case 0x11: AddrMode<NesAddrMode::IndY>(); ORA(); break;
+		case 0x12: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x13: AddrMode<NesAddrMode::IndYW>(); SLO(); break;
+		case 0x14: AddrMode<NesAddrMode::ZeroX>(); NOP(); break;
+		case 0x15: AddrMode<NesAddrMode::ZeroX>(); ORA(); break;
+		case 0x16: AddrMode<NesAddrMode::ZeroX>(); ASL_Memory(); break;
+		case 0x17: AddrMode<NesAddrMode::ZeroX>(); SLO(); break;
+		case 0x18: AddrMode<NesAddrMode::Imp>(); CLC(); break;
+		case 0x19: AddrMode<NesAddrMode::AbsY>(); ORA(); break;
+		case 0x1A: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0x1B: AddrMode<NesAddrMode::AbsYW>(); SLO(); break;
+		case 0x1C: AddrMode<NesAddrMode::AbsX>(); NOP(); break;
+		case 0x1D: AddrMode<NesAddrMode::AbsX>(); ORA(); break;
+		case 0x1E: AddrMode<NesAddrMode::AbsXW>(); ASL_Memory(); break;
+		case 0x1F: AddrMode<NesAddrMode::AbsXW>(); SLO(); break;
+		case 0x20: AddrMode<NesAddrMode::Abs>(); JSR(); break;
+		case 0x21: AddrMode<NesAddrMode::IndX>(); AND(); break;
+		case 0x22: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x23: AddrMode<NesAddrMode::IndX>(); RLA(); break;
+		case 0x24: AddrMode<NesAddrMode::Zero>(); BIT(); break;
+		case 0x25: AddrMode<NesAddrMode::Zero>(); AND(); break;
+		case 0x26: AddrMode<NesAddrMode::Zero>(); ROL_Memory(); break;
+		case 0x27: AddrMode<NesAddrMode::Zero>(); RLA(); break;
+		case 0x28: AddrMode<NesAddrMode::Imp>(); PLP(); break;
+		case 0x29: AddrMode<NesAddrMode::Imm>(); AND(); break;
+		case 0x2A: AddrMode<NesAddrMode::Acc>(); ROL_Acc(); break;
+		case 0x2B: AddrMode<NesAddrMode::Imm>(); AAC(); break;
+		case 0x2C: AddrMode<NesAddrMode::Abs>(); BIT(); break;
+		case 0x2D: AddrMode<NesAddrMode::Abs>(); AND(); break;
+		case 0x2E: AddrMode<NesAddrMode::Abs>(); ROL_Memory(); break;
+		case 0x2F: AddrMode<NesAddrMode::Abs>(); RLA(); break;
+		case 0x30: AddrMode<NesAddrMode::Rel>(); BMI(); break;
+		case 0x31: AddrMode<NesAddrMode::IndY>(); AND(); break;
+		case 0x32: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x33: AddrMode<NesAddrMode::IndYW>(); RLA(); break;
+		case 0x34: AddrMode<NesAddrMode::ZeroX>(); NOP(); break;
+		case 0x35: AddrMode<NesAddrMode::ZeroX>(); AND(); break;
+		case 0x36: AddrMode<NesAddrMode::ZeroX>(); ROL_Memory(); break;
+		case 0x37: AddrMode<NesAddrMode::ZeroX>(); RLA(); break;
+		case 0x38: AddrMode<NesAddrMode::Imp>(); SEC(); break;
+		case 0x39: AddrMode<NesAddrMode::AbsY>(); AND(); break;
+		case 0x3A: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0x3B: AddrMode<NesAddrMode::AbsYW>(); RLA(); break;
+		case 0x3C: AddrMode<NesAddrMode::AbsX>(); NOP(); break;
+		case 0x3D: AddrMode<NesAddrMode::AbsX>(); AND(); break;
+		case 0x3E: AddrMode<NesAddrMode::AbsXW>(); ROL_Memory(); break;
+		case 0x3F: AddrMode<NesAddrMode::AbsXW>(); RLA(); break;
+		case 0x40: AddrMode<NesAddrMode::Imp>(); RTI(); break;
+		case 0x41: AddrMode<NesAddrMode::IndX>(); EOR(); break;
+		case 0x42: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x43: AddrMode<NesAddrMode::IndX>(); SRE(); break;
+		case 0x44: AddrMode<NesAddrMode::Zero>(); NOP(); break;
+		case 0x45: AddrMode<NesAddrMode::Zero>(); EOR(); break;
+		case 0x46: AddrMode<NesAddrMode::Zero>(); LSR_Memory(); break;
+		case 0x47: AddrMode<NesAddrMode::Zero>(); SRE(); break;
+		case 0x48: AddrMode<NesAddrMode::Imp>(); PHA(); break;
+		case 0x49: AddrMode<NesAddrMode::Imm>(); EOR(); break;
+		case 0x4A: AddrMode<NesAddrMode::Acc>(); LSR_Acc(); break;
+		case 0x4B: AddrMode<NesAddrMode::Imm>(); ASR(); break;
+		case 0x4C: AddrMode<NesAddrMode::Abs>(); JMP_Abs(); break;
+		case 0x4D: AddrMode<NesAddrMode::Abs>(); EOR(); break;
+		case 0x4E: AddrMode<NesAddrMode::Abs>(); LSR_Memory(); break;
+		case 0x4F: AddrMode<NesAddrMode::Abs>(); SRE(); break;
+		case 0x50: AddrMode<NesAddrMode::Rel>(); BVC(); break;
+		case 0x51: AddrMode<NesAddrMode::IndY>(); EOR(); break;
+		case 0x52: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x53: AddrMode<NesAddrMode::IndYW>(); SRE(); break;
+		case 0x54: AddrMode<NesAddrMode::ZeroX>(); NOP(); break;
+		case 0x55: AddrMode<NesAddrMode::ZeroX>(); EOR(); break;
+		case 0x56: AddrMode<NesAddrMode::ZeroX>(); LSR_Memory(); break;
+		case 0x57: AddrMode<NesAddrMode::ZeroX>(); SRE(); break;
+		case 0x58: AddrMode<NesAddrMode::Imp>(); CLI(); break;
+		case 0x59: AddrMode<NesAddrMode::AbsY>(); EOR(); break;
+		case 0x5A: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0x5B: AddrMode<NesAddrMode::AbsYW>(); SRE(); break;
+		case 0x5C: AddrMode<NesAddrMode::AbsX>(); NOP(); break;
+		case 0x5D: AddrMode<NesAddrMode::AbsX>(); EOR(); break;
+		case 0x5E: AddrMode<NesAddrMode::AbsXW>(); LSR_Memory(); break;
+		case 0x5F: AddrMode<NesAddrMode::AbsXW>(); SRE(); break;
+		case 0x60: AddrMode<NesAddrMode::Imp>(); RTS(); break;
+		case 0x61: AddrMode<NesAddrMode::IndX>(); ADC(); break;
+		case 0x62: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x63: AddrMode<NesAddrMode::IndX>(); RRA(); break;
+		case 0x64: AddrMode<NesAddrMode::Zero>(); NOP(); break;
+		case 0x65: AddrMode<NesAddrMode::Zero>(); ADC(); break;
+		case 0x66: AddrMode<NesAddrMode::Zero>(); ROR_Memory(); break;
+		case 0x67: AddrMode<NesAddrMode::Zero>(); RRA(); break;
+		case 0x68: AddrMode<NesAddrMode::Imp>(); PLA(); break;
+		case 0x69: AddrMode<NesAddrMode::Imm>(); ADC(); break;
+		case 0x6A: AddrMode<NesAddrMode::Acc>(); ROR_Acc(); break;
+		case 0x6B: AddrMode<NesAddrMode::Imm>(); ARR(); break;
+		case 0x6C: AddrMode<NesAddrMode::Ind>(); JMP_Ind(); break;
+		case 0x6D: AddrMode<NesAddrMode::Abs>(); ADC(); break;
+		case 0x6E: AddrMode<NesAddrMode::Abs>(); ROR_Memory(); break;
+		case 0x6F: AddrMode<NesAddrMode::Abs>(); RRA(); break;
+		case 0x70: AddrMode<NesAddrMode::Rel>(); BVS(); break;
+		case 0x71: AddrMode<NesAddrMode::IndY>(); ADC(); break;
+		case 0x72: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x73: AddrMode<NesAddrMode::IndYW>(); RRA(); break;
+		case 0x74: AddrMode<NesAddrMode::ZeroX>(); NOP(); break;
+		case 0x75: AddrMode<NesAddrMode::ZeroX>(); ADC(); break;
+		case 0x76: AddrMode<NesAddrMode::ZeroX>(); ROR_Memory(); break;
+		case 0x77: AddrMode<NesAddrMode::ZeroX>(); RRA(); break;
+		case 0x78: AddrMode<NesAddrMode::Imp>(); SEI(); break;
+		case 0x79: AddrMode<NesAddrMode::AbsY>(); ADC(); break;
+		case 0x7A: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0x7B: AddrMode<NesAddrMode::AbsYW>(); RRA(); break;
+		case 0x7C: AddrMode<NesAddrMode::AbsX>(); NOP(); break;
+		case 0x7D: AddrMode<NesAddrMode::AbsX>(); ADC(); break;
+		case 0x7E: AddrMode<NesAddrMode::AbsXW>(); ROR_Memory(); break;
+		case 0x7F: AddrMode<NesAddrMode::AbsXW>(); RRA(); break;
+		case 0x80: AddrMode<NesAddrMode::Imm>(); NOP(); break;
+		case 0x81: AddrMode<NesAddrMode::IndX>(); STA(); break;
+		case 0x82: AddrMode<NesAddrMode::Imm>(); NOP(); break;
+		case 0x83: AddrMode<NesAddrMode::IndX>(); SAX(); break;
+		case 0x84: AddrMode<NesAddrMode::Zero>(); STY(); break;
+		case 0x85: AddrMode<NesAddrMode::Zero>(); STA(); break;
+		case 0x86: AddrMode<NesAddrMode::Zero>(); STX(); break;
+		case 0x87: AddrMode<NesAddrMode::Zero>(); SAX(); break;
+		case 0x88: AddrMode<NesAddrMode::Imp>(); DEY(); break;
+		case 0x89: AddrMode<NesAddrMode::Imm>(); NOP(); break;
+		case 0x8A: AddrMode<NesAddrMode::Imp>(); TXA(); break;
+		case 0x8B: AddrMode<NesAddrMode::Imm>(); UNK(); break;
+		case 0x8C: AddrMode<NesAddrMode::Abs>(); STY(); break;
+		case 0x8D: AddrMode<NesAddrMode::Abs>(); STA(); break;
+		case 0x8E: AddrMode<NesAddrMode::Abs>(); STX(); break;
+		case 0x8F: AddrMode<NesAddrMode::Abs>(); SAX(); break;
+		case 0x90: AddrMode<NesAddrMode::Rel>(); BCC(); break;
+		case 0x91: AddrMode<NesAddrMode::IndYW>(); STA(); break;
+		case 0x92: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0x93: AddrMode<NesAddrMode::IndYW>(); AXA(); break;
+		case 0x94: AddrMode<NesAddrMode::ZeroX>(); STY(); break;
+		case 0x95: AddrMode<NesAddrMode::ZeroX>(); STA(); break;
+		case 0x96: AddrMode<NesAddrMode::ZeroY>(); STX(); break;
+		case 0x97: AddrMode<NesAddrMode::ZeroY>(); SAX(); break;
+		case 0x98: AddrMode<NesAddrMode::Imp>(); TYA(); break;
+		case 0x99: AddrMode<NesAddrMode::AbsYW>(); STA(); break;
+		case 0x9A: AddrMode<NesAddrMode::Imp>(); TXS(); break;
+		case 0x9B: AddrMode<NesAddrMode::AbsYW>(); TAS(); break;
+		case 0x9C: AddrMode<NesAddrMode::AbsXW>(); SYA(); break;
+		case 0x9D: AddrMode<NesAddrMode::AbsXW>(); STA(); break;
+		case 0x9E: AddrMode<NesAddrMode::AbsYW>(); SXA(); break;
+		case 0x9F: AddrMode<NesAddrMode::AbsYW>(); AXA(); break;
+		case 0xA0: AddrMode<NesAddrMode::Imm>(); LDY(); break;
+		case 0xA1: AddrMode<NesAddrMode::IndX>(); LDA(); break;
+		case 0xA2: AddrMode<NesAddrMode::Imm>(); LDX(); break;
+		case 0xA3: AddrMode<NesAddrMode::IndX>(); LAX(); break;
+		case 0xA4: AddrMode<NesAddrMode::Zero>(); LDY(); break;
+		case 0xA5: AddrMode<NesAddrMode::Zero>(); LDA(); break;
+		case 0xA6: AddrMode<NesAddrMode::Zero>(); LDX(); break;
+		case 0xA7: AddrMode<NesAddrMode::Zero>(); LAX(); break;
+		case 0xA8: AddrMode<NesAddrMode::Imp>(); TAY(); break;
+		case 0xA9: AddrMode<NesAddrMode::Imm>(); LDA(); break;
+		case 0xAA: AddrMode<NesAddrMode::Imp>(); TAX(); break;
+		case 0xAB: AddrMode<NesAddrMode::Imm>(); ATX(); break;
+		case 0xAC: AddrMode<NesAddrMode::Abs>(); LDY(); break;
+		case 0xAD: AddrMode<NesAddrMode::Abs>(); LDA(); break;
+		case 0xAE: AddrMode<NesAddrMode::Abs>(); LDX(); break;
+		case 0xAF: AddrMode<NesAddrMode::Abs>(); LAX(); break;
+		case 0xB0: AddrMode<NesAddrMode::Rel>(); BCS(); break;
+		case 0xB1: AddrMode<NesAddrMode::IndY>(); LDA(); break;
+		case 0xB2: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0xB3: AddrMode<NesAddrMode::IndY>(); LAX(); break;
+		case 0xB4: AddrMode<NesAddrMode::ZeroX>(); LDY(); break;
+		case 0xB5: AddrMode<NesAddrMode::ZeroX>(); LDA(); break;
+		case 0xB6: AddrMode<NesAddrMode::ZeroY>(); LDX(); break;
+		case 0xB7: AddrMode<NesAddrMode::ZeroY>(); LAX(); break;
+		case 0xB8: AddrMode<NesAddrMode::Imp>(); CLV(); break;
+		case 0xB9: AddrMode<NesAddrMode::AbsY>(); LDA(); break;
+		case 0xBA: AddrMode<NesAddrMode::Imp>(); TSX(); break;
+		case 0xBB: AddrMode<NesAddrMode::AbsY>(); LAS(); break;
+		case 0xBC: AddrMode<NesAddrMode::AbsX>(); LDY(); break;
+		case 0xBD: AddrMode<NesAddrMode::AbsX>(); LDA(); break;
+		case 0xBE: AddrMode<NesAddrMode::AbsY>(); LDX(); break;
+		case 0xBF: AddrMode<NesAddrMode::AbsY>(); LAX(); break;
+		case 0xC0: AddrMode<NesAddrMode::Imm>(); CPY(); break;
+		case 0xC1: AddrMode<NesAddrMode::IndX>(); CPA(); break;
+		case 0xC2: AddrMode<NesAddrMode::Imm>(); NOP(); break;
+		case 0xC3: AddrMode<NesAddrMode::IndX>(); DCP(); break;
+		case 0xC4: AddrMode<NesAddrMode::Zero>(); CPY(); break;
+		case 0xC5: AddrMode<NesAddrMode::Zero>(); CPA(); break;
+		case 0xC6: AddrMode<NesAddrMode::Zero>(); DEC(); break;
+		case 0xC7: AddrMode<NesAddrMode::Zero>(); DCP(); break;
+		case 0xC8: AddrMode<NesAddrMode::Imp>(); INY(); break;
+		case 0xC9: AddrMode<NesAddrMode::Imm>(); CPA(); break;
+		case 0xCA: AddrMode<NesAddrMode::Imp>(); DEX(); break;
+		case 0xCB: AddrMode<NesAddrMode::Imm>(); AXS(); break;
+		case 0xCC: AddrMode<NesAddrMode::Abs>(); CPY(); break;
+		case 0xCD: AddrMode<NesAddrMode::Abs>(); CPA(); break;
+		case 0xCE: AddrMode<NesAddrMode::Abs>(); DEC(); break;
+		case 0xCF: AddrMode<NesAddrMode::Abs>(); DCP(); break;
+		case 0xD0: AddrMode<NesAddrMode::Rel>(); BNE(); break;
+		case 0xD1: AddrMode<NesAddrMode::IndY>(); CPA(); break;
+		case 0xD2: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0xD3: AddrMode<NesAddrMode::IndYW>(); DCP(); break;
+		case 0xD4: AddrMode<NesAddrMode::ZeroX>(); NOP(); break;
+		case 0xD5: AddrMode<NesAddrMode::ZeroX>(); CPA(); break;
+		case 0xD6: AddrMode<NesAddrMode::ZeroX>(); DEC(); break;
+		case 0xD7: AddrMode<NesAddrMode::ZeroX>(); DCP(); break;
+		case 0xD8: AddrMode<NesAddrMode::Imp>(); CLD(); break;
+		case 0xD9: AddrMode<NesAddrMode::AbsY>(); CPA(); break;
+		case 0xDA: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0xDB: AddrMode<NesAddrMode::AbsYW>(); DCP(); break;
+		case 0xDC: AddrMode<NesAddrMode::AbsX>(); NOP(); break;
+		case 0xDD: AddrMode<NesAddrMode::AbsX>(); CPA(); break;
+		case 0xDE: AddrMode<NesAddrMode::AbsXW>(); DEC(); break;
+		case 0xDF: AddrMode<NesAddrMode::AbsXW>(); DCP(); break;
+		case 0xE0: AddrMode<NesAddrMode::Imm>(); CPX(); break;
+		case 0xE1: AddrMode<NesAddrMode::IndX>(); SBC(); break;
+		case 0xE2: AddrMode<NesAddrMode::Imm>(); NOP(); break;
+		case 0xE3: AddrMode<NesAddrMode::IndX>(); ISB(); break;
+		case 0xE4: AddrMode<NesAddrMode::Zero>(); CPX(); break;
+		case 0xE5: AddrMode<NesAddrMode::Zero>(); SBC(); break;
+		case 0xE6: AddrMode<NesAddrMode::Zero>(); INC(); break;
+		case 0xE7: AddrMode<NesAddrMode::Zero>(); ISB(); break;
+		case 0xE8: AddrMode<NesAddrMode::Imp>(); INX(); break;
+		case 0xE9: AddrMode<NesAddrMode::Imm>(); SBC(); break;
+		case 0xEA: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0xEB: AddrMode<NesAddrMode::Imm>(); SBC(); break;
+		case 0xEC: AddrMode<NesAddrMode::Abs>(); CPX(); break;
+		case 0xED: AddrMode<NesAddrMode::Abs>(); SBC(); break;
+		case 0xEE: AddrMode<NesAddrMode::Abs>(); INC(); break;
+		case 0xEF: AddrMode<NesAddrMode::Abs>(); ISB(); break;
+		case 0xF0: AddrMode<NesAddrMode::Rel>(); BEQ(); break;
+		case 0xF1: AddrMode<NesAddrMode::IndY>(); SBC(); break;
+		case 0xF2: AddrMode<NesAddrMode::None>(); HLT(); break;
+		case 0xF3: AddrMode<NesAddrMode::IndYW>(); ISB(); break;
+		case 0xF4: AddrMode<NesAddrMode::ZeroX>(); NOP(); break;
+		case 0xF5: AddrMode<NesAddrMode::ZeroX>(); SBC(); break;
+		case 0xF6: AddrMode<NesAddrMode::ZeroX>(); INC(); break;
+		case 0xF7: AddrMode<NesAddrMode::ZeroX>(); ISB(); break;
+		case 0xF8: AddrMode<NesAddrMode::Imp>(); SED(); break;
+		case 0xF9: AddrMode<NesAddrMode::AbsY>(); SBC(); break;
+		case 0xFA: AddrMode<NesAddrMode::Imp>(); NOP(); break;
+		case 0xFB: AddrMode<NesAddrMode::AbsYW>(); ISB(); break;
+		case 0xFC: AddrMode<NesAddrMode::AbsX>(); NOP(); break;
+		case 0xFD: AddrMode<NesAddrMode::AbsX>(); SBC(); break;
+		case 0xFE: AddrMode<NesAddrMode::AbsXW>(); INC(); break;
+		case 0xFF: AddrMode<NesAddrMode::AbsXW>(); ISB(); break;
+	}
+}
+
 void NesCpu::EndCpuCycle(bool forRead)
 {
 	_masterClock += forRead ? (_endClockCount + 1) : (_endClockCount - 1);
@@ -24,16 +24,12 @@ public:
 	static constexpr uint16_t IRQVector = 0xFFFE;
 
 private:
-	typedef void(NesCpu::*Func)();
-
 	uint64_t _masterClock;
 	uint8_t _ppuOffset;
 	uint8_t _startClockCount;
 	uint8_t _endClockCount;
 	uint16_t _operand;
 
-	Func _opTable[256];
-	NesAddrMode _addrMode[256];
 	NesAddrMode _instAddrMode;
 
 	bool _needHalt = false;
@@ -64,7 +60,9 @@ private:
 	__forceinline void StartCpuCycle(bool forRead);
 	__forceinline void ProcessPendingDma(uint16_t readAddress);
 	uint8_t ProcessDmaRead(uint16_t addr, uint16_t& prevReadAddress, bool enableInternalRegReads, bool isNesBehavior);
-	__forceinline uint16_t FetchOperand();
+	template<NesAddrMode mode> __forceinline void AddrMode();
+	void ProcessCpuCrash();
+	void RunOp(uint8_t opCode);
 	__forceinline void EndCpuCycle(bool forRead);
 	void IRQ();
 
@@ -73,6 +73,7 @@ void NesMemoryManager::RegisterIODevice(INesMemoryHandler*handler)
 
 	InitializeMemoryHandlers(_ramReadHandlers, handler, ranges.GetRAMReadAddresses(), ranges.GetAllowOverride());
 	InitializeMemoryHandlers(_ramWriteHandlers, handler, ranges.GetRAMWriteAddresses(), ranges.GetAllowOverride());
+	UpdatePageHandlers();
 }
 
 void NesMemoryManager::RegisterWriteHandler(INesMemoryHandler* handler, uint32_t start, uint32_t end)
@@ -80,6 +81,7 @@ void NesMemoryManager::RegisterWriteHandler(INesMemoryHandler* handler, uint32_t
 	for(uint32_t i = start; i < end; i++) {
 		_ramWriteHandlers[i] = handler;
 	}
+	UpdatePageHandlers();
 }
 
 void NesMemoryManager::UnregisterIODevice(INesMemoryHandler*handler)
@@ -94,6 +96,35 @@ void NesMemoryManager::UnregisterIODevice(INesMemoryHandler*handler)
 	for(uint16_t address : *ranges.GetRAMWriteAddresses()) {
 		_ramWriteHandlers[address] = &_openBusHandler;
 	}
+	UpdatePageHandlers();
+}
+
+void NesMemoryManager::UpdatePageHandlers()
+{
+	for(int page = 0; page < 0x100; page++) {
+		INesMemoryHandler* readHandler = _ramReadHandlers[page << 8];
+		INesMemoryHandler* writeHandler = _ramWriteHandlers[page << 8];
+		for(int i = page << 8, end = i + 0x100; i < end; i++) {
+			if(_ramReadHandlers[i] != readHandler) {
+				readHandler = nullptr;
+			}
+			if(_ramWriteHandlers[i] != writeHandler) {
+				writeHandler = nullptr;
+			}
+		}
+		_readPageHandlers[page] = readHandler;
+		_writePageHandlers[page] = writeHandler;
+	}
+	UpdateDirectPages(0, 0xFF);
+}
+
+void NesMemoryManager::UpdateDirectPages(uint8_t startPage, uint8_t endPage)
+{
+	//Called when the mapper changes its PRG mappings/registers
+	for(int page = startPage; page <= endPage; page++) {
+		_readPages[page] = _readPageHandlers[page] ? _readPageHandlers[page]->GetDirectReadPage(page) : nullptr;
+		_writePages[page] = _writePageHandlers[page] ? _writePageHandlers[page]->GetDirectWritePage(page) : nullptr;
+	}
 }
 
 uint8_t* NesMemoryManager::GetInternalRam()
@@ -117,7 +148,8 @@ uint16_t NesMemoryManager::DebugReadWord(uint16_t addr)
 
 uint8_t NesMemoryManager::Read(uint16_t addr, MemoryOperationType operationType)
 {
-	uint8_t value = _ramReadHandlers[addr]->ReadRam(addr);
+	uint8_t* page = _readPages[addr >> 8];
+	uint8_t value = page ? page[(uint8_t)addr] : _ramReadHandlers[addr]->ReadRam(addr);
 	if(_cheatManager->HasCheats<CpuType::Nes>()) {
 		_cheatManager->ApplyCheat<CpuType::Nes>(addr, value);
 	}
@@ -131,7 +163,11 @@ uint8_t NesMemoryManager::Read(uint16_t addr, MemoryOperationType operationType)
 void NesMemoryManager::Write(uint16_t addr, uint8_t value, MemoryOperationType operationType)
 {
 	if(_emu->ProcessMemoryWrite<CpuType::Nes>(addr, value, operationType)) {
-		_ramWriteHandlers[addr]->WriteRam(addr, value);
+		if(uint8_t* page = _writePages[addr >> 8]) {
+			page[(uint8_t)addr] = value;
+		} else {
+			_ramWriteHandlers[addr]->WriteRam(addr, value);
+		}
 		_openBusHandler.SetOpenBus(value);
 	}
 }
@@ -33,7 +33,16 @@ private:
 	INesMemoryHandler** _ramReadHandlers = nullptr;
 	INesMemoryHandler** _ramWriteHandlers = nullptr;
 
+	//Handler for each 256-byte page (null when the page is shared by more than one handler)
+	INesMemoryHandler* _readPageHandlers[0x100] = {};
+	INesMemoryHandler* _writePageHandlers[0x100] = {};
+
+	//Direct pointers to each page's memory (null when accesses have side effects and must go through the handler)
+	uint8_t* _readPages[0x100] = {};
+	uint8_t* _writePages[0x100] = {};
+
 	void InitializeMemoryHandlers(INesMemoryHandler** memoryHandlers, INesMemoryHandler* handler, vector<uint16_t>* addresses, bool allowOverride);
+	void UpdatePageHandlers();
 
 protected:
 	void Serialize(Serializer& s) override;
@@ -46,6 +55,7 @@ public:
 	void RegisterIODevice(INesMemoryHandler* handler);
 	void RegisterWriteHandler(INesMemoryHandler* handler, uint32_t start, uint32_t end);
 	void UnregisterIODevice(INesMemoryHandler* handler);
+	void UpdateDirectPages(uint8_t startPage, uint8_t endPage);
 
 	uint8_t DebugRead(uint16_t addr);
 	uint16_t DebugReadWord(uint16_t addr);
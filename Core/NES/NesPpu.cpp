@@ -1121,14 +1121,31 @@ template<class T> void NesPpu<T>::SendFrame()
 			_emu->ProcessEndOfFrame();
 		}
 	} else {
-		bool forRewind = _emu->GetRewindManager()->IsRewinding();
-		_emu->GetVideoDecoder()->UpdateFrame(frame, forRewind, forRewind);
+		if(!_skipRender) {
+			bool forRewind = _emu->GetRewindManager()->IsRewinding();
+			_emu->GetVideoDecoder()->UpdateFrame(frame, forRewind, forRewind);
+		}
 		_emu->ProcessEndOfFrame();
 	}
 
 	_enableOamDecay = _settings->GetNesConfig().EnableOamDecay;
 }
 
+template<class T> bool NesPpu<T>::CanSkipFrames()
+{
+	if(_settings->GetNesConfig().DisableFrameSkipping || _emu->IsDebugging() || _console->GetVsMainConsole() || _console->GetVsSubConsole()) {
+		return false;
+	}
+
+	//Light guns read the pixels drawn by the PPU
+	BaseControlManager* controlManager = _console->GetControlManager();
+	return (
+		!controlManager->HasControlDevice(ControllerType::NesZapper) &&
+		!controlManager->HasControlDevice(ControllerType::FamicomZapper) &&
+		!controlManager->HasControlDevice(ControllerType::BandaiHyperShot)
+	);
+}
+
 template<class T> void NesPpu<T>::SendFrameVsDualSystem()
 {
 	NesConfig& cfg = _settings->GetNesConfig();
@@ -1298,6 +1315,8 @@ template<class T> void NesPpu<T>::ProcessScanlineFirstCycle()
 
 		_emu->ProcessEvent(EventType::StartFrame);
 
+		_skipRender = ((T*)this)->AllowFrameSkip() && _frameSkip.ProcessStartFrame(_emu, CanSkipFrames());
+
 		UpdateMinimumDrawCycles();
 	}
 
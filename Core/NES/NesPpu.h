@@ -79,6 +79,7 @@ protected:
 	void SendFrame();
 
 	void SendFrameVsDualSystem();
+	bool CanSkipFrames();
 
 	void UpdateState();
 
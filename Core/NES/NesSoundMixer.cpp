@@ -50,6 +50,7 @@ void NesSoundMixer::Reset()
 
 	_previousOutputLeft = 0;
 	_previousOutputRight = 0;
+	_outputChanged = false;
 	blip_clear(_blipBufLeft);
 	blip_clear(_blipBufRight);
 
@@ -67,7 +68,12 @@ void NesSoundMixer::Reset()
 
 void NesSoundMixer::PlayAudioBuffer(uint32_t time)
 {
-	EndFrame(time);
+	if(_skipSynthesis) {
+		EndFrameWithoutSynthesis(time);
+	} else {
+		EndFrame(time);
+	}
+	_skipSynthesis = _mixer->IsSynthesisSkipped();
 
 	int16_t* out = _outputBuffer + (_sampleCount * 2);
 	size_t sampleCount = blip_read_samples(_blipBufLeft, out, NesSoundMixer::MaxSamplesPerFrame, 1);
@@ -93,7 +99,7 @@ void NesSoundMixer::PlayAudioBuffer(uint32_t time)
 		ProcessVsDualSystemAudio();
 	}
 
-	switch(cfg.StereoFilter) {
+	switch(_skipSynthesis ? StereoFilterType::None : cfg.StereoFilter) {
 		case StereoFilterType::None: break;
 		case StereoFilterType::Delay: _stereoDelay.ApplyFilter(_outputBuffer, _sampleCount, _sampleRate, cfg.StereoDelay); break;
 		case StereoFilterType::Panning: _stereoPanning.ApplyFilter(_outputBuffer, _sampleCount, cfg.StereoPanningAngle); break;
@@ -192,7 +198,10 @@ int16_t NesSoundMixer::GetOutputVolume(bool forRightChannel)
 }
 void NesSoundMixer::AddDelta(AudioChannel channel, uint32_t time, int16_t delta)
 {
-	if(delta != 0) {
+	if(_skipSynthesis) {
+		_currentOutput[(int)channel] += delta;
+		_outputChanged |= delta != 0;
+	} else if(delta != 0) {
 		_timestamps.push_back(time);
 		_channelOutput[(int)channel][time] += delta;
 	}
@@ -230,3 +239,21 @@ void NesSoundMixer::EndFrame(uint32_t time)
 	memset(_channelOutput, 0, sizeof(_channelOutput));
 }
 
+void NesSoundMixer::EndFrameWithoutSynthesis(uint32_t time)
+{
+	if(_outputChanged) {
+		//Only the final output level matters when no samples are generated - this matches
+		//the values EndFrame would have left in _previousOutputLeft/Right (which are saved in save states)
+		_previousOutputLeft = GetOutputVolume(false) * 4;
+		if(_hasPanning) {
+			_previousOutputRight = GetOutputVolume(true) * 4;
+		}
+		_outputChanged = false;
+	}
+
+	//The output stays flat for the frame, but the blip buffers still produce the expected number of samples
+	blip_end_frame(_blipBufLeft, time);
+	if(_hasPanning) {
+		blip_end_frame(_blipBufRight, time);
+	}
+}
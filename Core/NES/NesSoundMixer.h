@@ -49,9 +49,14 @@ private:
 
 	bool _hasPanning = false;
 
+	//When the sound mixer skips synthesis, deltas are applied directly to _currentOutput instead of going through blip_buf
+	bool _skipSynthesis = false;
+	bool _outputChanged = false;
+
 	__forceinline double GetChannelOutput(AudioChannel channel, bool forRightChannel);
 	__forceinline int16_t GetOutputVolume(bool forRightChannel);
 	void EndFrame(uint32_t time);
+	void EndFrameWithoutSynthesis(uint32_t time);
 
 	void ProcessVsDualSystemAudio();
 
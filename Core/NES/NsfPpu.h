@@ -32,6 +32,11 @@ public:
 	{
 	}
 
+	__forceinline bool AllowFrameSkip()
+	{
+		return false;
+	}
+
 	void* OnBeforeSendFrame()
 	{
 		return nullptr;
@@ -7,6 +7,7 @@
 #include "PCE/PceConstants.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/Audio/SoundMixer.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/HexUtilities.h"
 #include "Utilities/Serializer.h"
@@ -273,9 +274,11 @@ void PceAdpcm::PlaySample()
 		SetHalfReached(false);
 	}
 
-	int16_t out = (_currentOutput - 2048) * 10;
-	_samplesToPlay.push_back(out);
-	_samplesToPlay.push_back(out);
+	if(!_emu->GetSoundMixer()->IsSynthesisSkipped()) {
+		int16_t out = (_currentOutput - 2048) * 10;
+		_samplesToPlay.push_back(out);
+		_samplesToPlay.push_back(out);
+	}
 }
 
 void PceAdpcm::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate)
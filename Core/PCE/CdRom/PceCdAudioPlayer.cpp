@@ -4,14 +4,17 @@
 #include "PCE/PceTypes.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/Audio/SoundMixer.h"
 #include "Shared/CdReader.h"
+#include "Shared/CdSectorCache.h"
 #include "Utilities/Serializer.h"
 
-PceCdAudioPlayer::PceCdAudioPlayer(Emulator* emu, PceCdRom* cdrom, DiscInfo& disc)
+PceCdAudioPlayer::PceCdAudioPlayer(Emulator* emu, PceCdRom* cdrom, DiscInfo& disc, CdSectorCache& sectorCache)
 {
 	_emu = emu;
 	_cdrom = cdrom;
 	_disc = &disc;
+	_sectorCache = &sectorCache;
 	_state.Status = CdAudioStatus::Inactive;
 }
 
@@ -29,6 +32,8 @@ void PceCdAudioPlayer::Play(uint32_t startSector, bool pause)
 		_state.CurrentSector = startSector;
 
 		_clockCounter = 0;
+
+		_sectorCache->Prefetch(startSector, CdReadStream::Audio);
 	}
 }
 
@@ -37,15 +42,22 @@ void PceCdAudioPlayer::SetEndPosition(uint32_t endSector, CdPlayEndBehavior endB
 	_state.EndSector = endSector;
 	_state.EndBehavior = endBehavior;
 	_state.Status = CdAudioStatus::Playing;
+
+	if(endBehavior == CdPlayEndBehavior::Loop) {
+		//Keep the start of the loop in memory
+		_sectorCache->Prefetch(_state.StartSector, CdReadStream::AudioLoop);
+	}
 }
 
 void PceCdAudioPlayer::PlaySample()
 {
 	if(_state.Status == CdAudioStatus::Playing) {
-		_state.LeftSample = _disc->ReadLeftSample(_state.CurrentSector, _state.CurrentSample);
-		_state.RightSample = _disc->ReadRightSample(_state.CurrentSector, _state.CurrentSample);
-		_samplesToPlay.push_back(_state.LeftSample);
-		_samplesToPlay.push_back(_state.RightSample);
+		_state.LeftSample = _sectorCache->ReadLeftSample(_state.CurrentSector, _state.CurrentSample);
+		_state.RightSample = _sectorCache->ReadRightSample(_state.CurrentSector, _state.CurrentSample);
+		if(!_emu->GetSoundMixer()->IsSynthesisSkipped()) {
+			_samplesToPlay.push_back(_state.LeftSample);
+			_samplesToPlay.push_back(_state.RightSample);
+		}
 		_state.CurrentSample++;
 		if(_state.CurrentSample == 588) {
 			//588 samples per 2352-byte sector
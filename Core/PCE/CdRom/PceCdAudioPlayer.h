@@ -8,11 +8,13 @@
 class Emulator;
 class PceCdRom;
 struct DiscInfo;
+class CdSectorCache;
 
 class PceCdAudioPlayer final : public IAudioProvider, public ISerializable
 {
 	Emulator* _emu = nullptr;
 	DiscInfo* _disc = nullptr;
+	CdSectorCache* _sectorCache = nullptr;
 	PceCdRom* _cdrom = nullptr;
 
 	PceCdAudioPlayerState _state = {};
@@ -25,7 +27,7 @@ class PceCdAudioPlayer final : public IAudioProvider, public ISerializable
 	void PlaySample();
 
 public:
-	PceCdAudioPlayer(Emulator* emu, PceCdRom* cdrom, DiscInfo& disc);
+	PceCdAudioPlayer(Emulator* emu, PceCdRom* cdrom, DiscInfo& disc, CdSectorCache& sectorCache);
 
 	void Play(uint32_t startSector, bool pause);
 	void SetEndPosition(uint32_t endSector, CdPlayEndBehavior endBehavior);
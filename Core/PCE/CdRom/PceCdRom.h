@@ -7,6 +7,7 @@
 #include "PCE/PceTypes.h"
 #include "Shared/MemoryType.h"
 #include "Shared/CdReader.h"
+#include "Shared/CdSectorCache.h"
 #include "Utilities/ISerializable.h"
 
 class Emulator;
@@ -20,6 +21,7 @@ private:
 	PceConsole* _console = nullptr;
 
 	DiscInfo _disc;
+	CdSectorCache _sectorCache;
 	PceScsiBus _scsi;
 	PceAdpcm _adpcm;
 	PceAudioFader _audioFader;
@@ -45,6 +47,7 @@ public:
 	PceAdpcmState& GetAdpcmState() { return _adpcm.GetState(); }
 	PceAudioFaderState& GetAudioFaderState() { return _audioFader.GetState(); }
 	PceCdAudioPlayerState& GetCdPlayerState() { return _audioPlayer.GetState(); }
+	CdSectorCacheStats GetSectorCacheStats() { return _sectorCache.GetStats(); }
 
 	__forceinline void Exec()
 	{
@@ -5,6 +5,7 @@
 #include "PCE/PceConsole.h"
 #include "PCE/PceTypes.h"
 #include "Shared/CdReader.h"
+#include "Shared/CdSectorCache.h"
 #include "Shared/Emulator.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/HexUtilities.h"
@@ -13,10 +14,11 @@
 
 using namespace ScsiSignal;
 
-PceScsiBus::PceScsiBus(Emulator* emu, PceConsole* console, PceCdRom* cdrom, DiscInfo& disc)
+PceScsiBus::PceScsiBus(Emulator* emu, PceConsole* console, PceCdRom* cdrom, DiscInfo& disc, CdSectorCache& sectorCache)
 {
 	_emu = emu;
 	_disc = &disc;
+	_sectorCache = &sectorCache;
 	_console = console;
 	_cdrom = cdrom;
 }
@@ -203,6 +205,9 @@ void PceScsiBus::CmdRead()
 
 	_readSectorCounter = GetSeekTime(_state.Sector, sector);
 	_needExec = true;
+
+	//The data will be needed once the seek delay is over, start loading it now
+	_sectorCache->Prefetch(sector, CdReadStream::Data);
 	_state.Sector = sector;
 	_state.SectorsToRead = sectorsToRead;
 
@@ -412,7 +417,7 @@ void PceScsiBus::ProcessDiscRead()
 			if(_dataBuffer.empty()) {
 				//read disc data
 				_dataBuffer.clear();
-				_disc->ReadDataSector(_state.Sector, _dataBuffer);
+				_sectorCache->ReadDataSector(_state.Sector, _dataBuffer);
 
 				LogDebug("[SCSI] Sector #" + std::to_string(_state.Sector) + " finished reading.");
 
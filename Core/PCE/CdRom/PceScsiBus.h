@@ -7,6 +7,7 @@ class Emulator;
 class PceConsole;
 class PceCdRom;
 struct DiscInfo;
+class CdSectorCache;
 
 namespace ScsiSignal
 {
@@ -48,6 +49,7 @@ private:
 	
 	Emulator* _emu = nullptr;
 	DiscInfo* _disc = nullptr;
+	CdSectorCache* _sectorCache = nullptr;
 	PceConsole* _console = nullptr;
 	PceCdRom* _cdrom = nullptr;
 
@@ -107,7 +109,7 @@ private:
 	void ProcessDiscRead();
 
 public:
-	PceScsiBus(Emulator* emu, PceConsole* console, PceCdRom* cdRom, DiscInfo& disc);
+	PceScsiBus(Emulator* emu, PceConsole* console, PceCdRom* cdRom, DiscInfo& disc, CdSectorCache& sectorCache);
 
 	PceScsiBusState& GetState() { return _state; }
 
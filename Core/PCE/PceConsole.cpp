@@ -48,9 +48,10 @@ LoadRomResult PceConsole::LoadRom(VirtualFile& romFile)
 			return LoadRomResult::Failure;
 		}
 		romData = _hesData->RomData;
-	} else if(romFile.GetFileExtension() == ".cue") {
+	} else if(romFile.GetFileExtension() == ".cue" || romFile.GetFileExtension() == ".chd") {
 		DiscInfo disc = {};
-		if(!CdReader::LoadCue(romFile, disc)) {
+		bool loaded = romFile.GetFileExtension() == ".chd" ? CdReader::LoadChd(romFile, disc) : CdReader::LoadCue(romFile, disc);
+		if(!loaded) {
 			return LoadRomResult::Failure;
 		}
 
@@ -386,6 +387,11 @@ void PceConsole::GetConsoleState(BaseState& baseState, ConsoleType consoleType)
 	state.HasCdRom = _cdrom != nullptr;
 }
 
+CdSectorCacheStats PceConsole::GetCdSectorCacheStats()
+{
+	return _cdrom ? _cdrom->GetSectorCacheStats() : CdSectorCacheStats {};
+}
+
 void PceConsole::Serialize(Serializer& s)
 {
 	SV(_cpu);
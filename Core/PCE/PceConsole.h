@@ -16,6 +16,7 @@ class Emulator;
 struct PceVideoState;
 struct HesFileData;
 struct DiscInfo;
+struct CdSectorCacheStats;
 enum class PceConsoleType;
 
 class PceConsole final: public IConsole
@@ -46,7 +47,7 @@ private:
 public:
 	PceConsole(Emulator* emu);
 	
-	static vector<string> GetSupportedExtensions() { return { ".pce", ".cue", ".sgx", ".hes" }; }
+	static vector<string> GetSupportedExtensions() { return { ".pce", ".cue", ".chd", ".sgx", ".hes" }; }
 	static vector<string> GetSupportedSignatures() { return { "HESM" }; }
 
 	void Serialize(Serializer& s) override;
@@ -94,4 +95,6 @@ public:
 	PceVideoState GetVideoState();
 	void SetVideoState(PceVideoState& state);
 	void GetConsoleState(BaseState& state, ConsoleType consoleType) override;
+
+	CdSectorCacheStats GetCdSectorCacheStats();
 };
\ No newline at end of file
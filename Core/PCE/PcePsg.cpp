@@ -89,11 +89,24 @@ void PcePsg::Write(uint16_t addr, uint8_t value)
 	}
 }
 
+void PcePsg::GetOutput(PcEngineConfig& cfg, int16_t& leftOutput, int16_t& rightOutput)
+{
+	leftOutput = 0;
+	rightOutput = 0;
+	for(int i = 0; i < 6; i++) {
+		PcePsgChannel& ch = _channels[i];
+		leftOutput += (int32_t)ch.GetOutput(true, _state.LeftVolume) * (int32_t)cfg.ChannelVol[i] / 100;
+		rightOutput += (int32_t)ch.GetOutput(false, _state.RightVolume) * (int32_t)cfg.ChannelVol[i] / 100;
+	}
+}
+
 void PcePsg::Run()
 {
 	uint64_t clock = _console->GetMasterClock();
 	uint32_t clocksToRun = clock - _lastClock;
 	PcEngineConfig& cfg = _emu->GetSettings()->GetPcEngineConfig();
+	bool skipSynthesis = _soundMixer->IsSynthesisSkipped();
+	bool ranChannels = clocksToRun >= 6;
 	while(clocksToRun >= 6) {
 		uint32_t minTimer = clocksToRun / 6;
 		for(int i = 0; i < 6; i++) {
@@ -103,18 +116,21 @@ void PcePsg::Run()
 			}
 		}
 
-		int16_t leftOutput = 0;
-		int16_t rightOutput = 0;
 		for(int i = 0; i < 6; i++) {
-			PcePsgChannel& ch = _channels[i];
-			ch.Run(minTimer);
-			leftOutput += (int32_t)ch.GetOutput(true, _state.LeftVolume) * (int32_t)cfg.ChannelVol[i] / 100;
-			rightOutput += (int32_t)ch.GetOutput(false, _state.RightVolume) * (int32_t)cfg.ChannelVol[i] / 100;
+			_channels[i].Run(minTimer);
 		}
 
 		_clockCounter += minTimer;
 		clocksToRun -= minTimer * 6;
 
+		if(skipSynthesis) {
+			continue;
+		}
+
+		int16_t leftOutput;
+		int16_t rightOutput;
+		GetOutput(cfg, leftOutput, rightOutput);
+
 		if(_prevLeftOutput != leftOutput) {
 			blip_add_delta(_leftChannel, _clockCounter, leftOutput - _prevLeftOutput);
 			_prevLeftOutput = leftOutput;
@@ -126,6 +142,11 @@ void PcePsg::Run()
 		}
 	}
 
+	if(skipSynthesis && ranChannels) {
+		//Keep the last output values in sync (they are part of save states), without generating any samples
+		GetOutput(cfg, _prevLeftOutput, _prevRightOutput);
+	}
+
 	if(_clockCounter >= 20000) {
 		blip_end_frame(_leftChannel, _clockCounter);
 		blip_end_frame(_rightChannel, _clockCounter);
@@ -8,6 +8,7 @@
 class Emulator;
 class PceConsole;
 class SoundMixer;
+struct PcEngineConfig;
 struct blip_t;
 
 class PcePsg final : public ISerializable
@@ -32,6 +33,8 @@ private:
 
 	uint32_t _clockCounter = 0;
 
+	__forceinline void GetOutput(PcEngineConfig& cfg, int16_t& leftOutput, int16_t& rightOutput);
+
 public:
 	PcePsg(Emulator* emu, PceConsole* console);
 	~PcePsg();
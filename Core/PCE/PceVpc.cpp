@@ -9,7 +9,6 @@
 #include "Shared/EmuSettings.h"
 #include "Shared/RewindManager.h"
 #include "Shared/Video/VideoDecoder.h"
-#include "Shared/Video/VideoRenderer.h"
 #include "Shared/NotificationManager.h"
 #include "Utilities/Serializer.h"
 #include "Shared/EventType.h"
@@ -151,21 +150,7 @@ void PceVpc::DrawScanline()
 
 void PceVpc::ProcessStartFrame()
 {
-	if(!_skipRender) {
-		_frameSkipTimer.Reset();
-	}
-
-	if(_emu->IsRunAheadFrame()) {
-		_skipRender = true;
-	} else {
-		_skipRender = (
-			!_emu->GetSettings()->GetPcEngineConfig().DisableFrameSkipping &&
-			!_emu->GetRewindManager()->IsRewinding() &&
-			!_emu->GetVideoRenderer()->IsRecording() &&
-			(_emu->GetSettings()->GetEmulationSpeed() == 0 || _emu->GetSettings()->GetEmulationSpeed() > 150) &&
-			_frameSkipTimer.GetElapsedMS() < 10
-		);
-	}
+	_skipRender = _frameSkip.ProcessStartFrame(_emu, !_emu->GetSettings()->GetPcEngineConfig().DisableFrameSkipping);
 }
 
 void PceVpc::ProcessScanlineStart(PceVdc* vdc, uint16_t scanline)
@@ -3,6 +3,7 @@
 #include "PCE/PceTypes.h"
 #include "PCE/PceConstants.h"
 #include "PCE/PceVdc.h"
+#include "Shared/Video/FrameSkipHelper.h"
 #include "Utilities/ISerializable.h"
 
 class PceVce;
@@ -26,7 +27,7 @@ private:
 	uint16_t* _currentOutBuffer = nullptr;
 	uint16_t _xStart = 0;
 
-	Timer _frameSkipTimer;
+	FrameSkipHelper _frameSkip;
 	bool _skipRender = false;
 
 	PceVpcState _state = {};
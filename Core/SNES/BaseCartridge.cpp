@@ -885,6 +885,11 @@ void BaseCartridge::RunCoprocessors()
 	if(_necDsp) {
 		_necDsp->Run();
 	}
+
+	if(_needCoprocSync && !_coprocessor->NeedSync()) {
+		//Catch up idle coprocessors, which aren't synced on every cycle
+		_coprocessor->Run();
+	}
 }
 
 BaseCoprocessor* BaseCartridge::GetCoprocessor()
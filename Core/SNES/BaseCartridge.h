@@ -133,7 +133,7 @@ public:
 	
 	__forceinline void SyncCoprocessors()
 	{
-		if(_needCoprocSync) {
+		if(_needCoprocSync && _coprocessor->NeedSync()) {
 			_coprocessor->Run();
 		}
 	}
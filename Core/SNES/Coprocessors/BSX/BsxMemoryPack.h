@@ -50,5 +50,8 @@ public:
 
 		uint8_t Read(uint32_t addr) override;
 		void Write(uint32_t addr, uint8_t value) override;
+
+		//Flash commands/status reads have side effects, all accesses must go through Read/Write
+		uint8_t* GetDirectPointer(bool forWrite) override { return nullptr; }
 	};
 };
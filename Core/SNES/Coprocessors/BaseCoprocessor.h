@@ -6,12 +6,25 @@
 
 class BaseCoprocessor : public ISerializable, public IMemoryHandler
 {
+protected:
+	//Cleared while the coprocessor is idle (e.g stopped or waiting for the S-CPU) and only its cycle counter moves forward.
+	//Idle coprocessors aren't synced on every S-CPU cycle - they are caught up before the S-CPU changes their state and at the end of the frame.
+	bool _needSync = true;
+
+	void CatchUp()
+	{
+		if(!_needSync) {
+			Run();
+		}
+	}
+
 public:
 	BaseCoprocessor() : IMemoryHandler(MemoryType::SnesRegister) {}
 
 	virtual void Reset() = 0;
 
 	virtual void Run() { }	
+	bool NeedSync() { return _needSync; }
 	virtual void ProcessEndOfFrame() { }
 	virtual void LoadBattery() { }
 	virtual void SaveBattery() { }
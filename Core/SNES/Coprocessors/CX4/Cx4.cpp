@@ -59,6 +59,7 @@ void Cx4::Reset()
 	_state.SingleRom = true;
 	_state.RomAccessDelay = 3;
 	_state.RamAccessDelay = 3;
+	UpdateNeedSync();
 }
 
 void Cx4::Run()
@@ -104,6 +105,8 @@ void Cx4::Run()
 			Exec(opCode);
 		}
 	}
+
+	UpdateNeedSync();
 }
 
 void Cx4::Step(uint64_t cycles)
@@ -332,6 +335,8 @@ void Cx4::Write(uint32_t addr, uint8_t value)
 		return;
 	} 
 	
+	CatchUp();
+
 	if(addr >= 0x7F60 && addr <= 0x7F7F) {
 		_state.Vectors[addr & 0x1F] = value;
 	} else if((addr >= 0x7F80 && addr <= 0x7FAF) || (addr >= 0x7FC0 && addr <= 0x7FEF)) {
@@ -417,6 +422,8 @@ void Cx4::Write(uint32_t addr, uint8_t value)
 				break;
 		}
 	}
+
+	UpdateNeedSync();
 }
 
 bool Cx4::IsRunning()
@@ -429,8 +436,18 @@ bool Cx4::IsBusy()
 	return _state.Cache.Enabled || _state.Dma.Enabled || _state.Bus.DelayCycles > 0;
 }
 
+void Cx4::UpdateNeedSync()
+{
+	//When stopped, Run() only increments the cycle counter until the S-CPU writes to a register
+	_needSync = IsRunning() || _state.Bus.Enabled || _state.Locked || _state.Suspend.Enabled;
+}
+
 void Cx4::Serialize(Serializer &s)
 {
+	if(s.IsSaving() && s.GetFormat() != SerializeFormat::Map) {
+		CatchUp();
+	}
+
 	SV(_state.CycleCount); SV(_state.PB); SV(_state.PC); SV(_state.A); SV(_state.P); SV(_state.SP); SV(_state.Mult); SV(_state.RomBuffer);
 	SV(_state.RamBuffer[0]); SV(_state.RamBuffer[1]); SV(_state.RamBuffer[2]); SV(_state.MemoryDataReg); SV(_state.MemoryAddressReg);
 	SV(_state.DataPointerReg); SV(_state.Negative); SV(_state.Zero); SV(_state.Carry); SV(_state.Overflow); SV(_state.IrqFlag); SV(_state.Stopped);
@@ -446,6 +463,10 @@ void Cx4::Serialize(Serializer &s)
 	SVArray(_prgRam[0], 256);
 	SVArray(_prgRam[1], 256);
 	SVArray(_dataRam, Cx4::DataRamSize);
+
+	if(!s.IsSaving()) {
+		UpdateNeedSync();
+	}
 }
 
 uint8_t Cx4::Peek(uint32_t addr)
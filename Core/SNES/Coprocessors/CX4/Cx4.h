@@ -33,6 +33,7 @@ private:
 	void Step(uint64_t cycles);
 	bool IsRunning();
 	bool IsBusy();
+	void UpdateNeedSync();
 
 	uint8_t GetAccessDelay(uint32_t addr);
 	uint8_t ReadCx4(uint32_t addr);
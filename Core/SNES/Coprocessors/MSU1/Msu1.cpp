@@ -3,6 +3,7 @@
 #include "SNES/Spc.h"
 #include "Shared/Emulator.h"
 #include "Shared/Audio/SoundMixer.h"
+#include "Shared/Audio/AudioTelemetry.h"
 #include "Utilities/Serializer.h"
 #include "Utilities/FolderUtilities.h"
 
@@ -25,19 +26,17 @@ Msu1::Msu1(Emulator* emu, VirtualFile& romFile, Spc* spc)
 	_spc = spc;
 	_romFolder = romFile.GetFolderPath();
 	_romName = FolderUtilities::GetFilename(romFile.GetFileName(), false);
-	_dataFile.open(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu", ios::binary);
-	if(_dataFile) {
+	if(ifstream(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu")) {
+		_dataFile.Open(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu");
 		_trackPath = FolderUtilities::CombinePath(_romFolder, _romName);
 	} else {
-		_dataFile.open(FolderUtilities::CombinePath(_romFolder, "msu1.rom"), ios::binary);
+		_dataFile.Open(FolderUtilities::CombinePath(_romFolder, "msu1.rom"));
 		_trackPath = FolderUtilities::CombinePath(_romFolder, "track");
 	}
 
-	if(_dataFile) {
-		_dataFile.seekg(0, ios::end);
-		_dataSize = (uint32_t)_dataFile.tellg();
-	} else {
-		_dataSize = 0;
+	_dataSize = (uint32_t)_dataFile.GetSize();
+	if(_dataSize) {
+		_dataFile.EnableReadAhead(Msu1::DataReadAheadSize);
 	}
 
 	_emu->GetSoundMixer()->RegisterAudioProvider(this);
@@ -57,7 +56,7 @@ void Msu1::Write(uint16_t addr, uint8_t value)
 		case 0x2003:
 			_tmpDataPointer = (_tmpDataPointer & 0x00FFFFFF) | (value << 24);
 			_dataPointer = _tmpDataPointer;
-			_dataFile.seekg(_dataPointer, ios::beg);
+			_dataFile.Seek(_dataPointer);
 			break;
 
 		case 0x2004: _trackSelect = (_trackSelect & 0xFF00) | value; break;
@@ -87,8 +86,10 @@ uint8_t Msu1::Read(uint16_t addr)
 		case 0x2001:
 			//data
 			if(!_dataBusy && _dataPointer < _dataSize) {
+				uint8_t value = _dataFile.GetData()[_dataPointer];
 				_dataPointer++;
-				return (uint8_t)_dataFile.get();
+				_dataFile.UpdateReadPosition(_dataPointer);
+				return value;
 			}
 			return 0;
 
@@ -109,6 +110,16 @@ void Msu1::MixAudio(int16_t* buffer, uint32_t sampleCount, uint32_t sampleRate)
 		_pcmReader.SetSampleRate(sampleRate);
 		_pcmReader.ApplySamples(buffer, (size_t)sampleCount, _spc->IsMuted() ? 0 : _volume);
 	}
+	RecordSeekStats();
+}
+
+void Msu1::RecordSeekStats()
+{
+	MappedFileSeekStats pcmStats = _pcmReader.TakeSeekStats();
+	MappedFileSeekStats dataStats = _dataFile.TakeSeekStats();
+	if(AudioTelemetry* telemetry = _emu->GetSoundMixer()->GetTelemetry()) {
+		telemetry->RecordStreamSeeks(pcmStats.SeekCount + dataStats.SeekCount, pcmStats.TotalLatencyUs + dataStats.TotalLatencyUs, std::max(pcmStats.MaxLatencyUs, dataStats.MaxLatencyUs));
+	}
 }
 
 void Msu1::LoadTrack(uint32_t startOffset)
@@ -121,7 +132,7 @@ void Msu1::Serialize(Serializer &s)
 	uint32_t offset = _pcmReader.GetOffset();
 	SV(_trackSelect); SV(_tmpDataPointer); SV(_dataPointer); SV(_repeat); SV(_paused); SV(_volume); SV(_trackMissing); SV(_audioBusy); SV(_dataBusy); SV(offset);
 	if(!s.IsSaving()) {
-		_dataFile.seekg(_dataPointer, ios::beg);
+		_dataFile.Seek(_dataPointer);
 		LoadTrack(offset);
 	}
 }
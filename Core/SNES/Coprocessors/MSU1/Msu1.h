@@ -4,6 +4,7 @@
 #include "Shared/Audio/PcmReader.h"
 #include "Utilities/ISerializable.h"
 #include "Utilities/VirtualFile.h"
+#include "Utilities/MemoryMappedFile.h"
 
 class Spc;
 class Emulator;
@@ -28,10 +29,13 @@ private:
 	bool _dataBusy = false; //Always false
 	bool _trackMissing = false;
 
-	ifstream _dataFile;
+	static constexpr int DataReadAheadSize = 0x100000;
+
+	MemoryMappedFile _dataFile;
 	uint32_t _dataSize;
 	
 	void LoadTrack(uint32_t startOffset = 8);
+	void RecordSeekStats();
 
 public:
 	Msu1(Emulator* emu, VirtualFile& romFile, Spc* spc);
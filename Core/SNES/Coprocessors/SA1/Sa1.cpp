@@ -238,6 +238,7 @@ void Sa1::CpuRegisterWrite(uint16_t addr, uint8_t value)
 	switch(addr) {
 		case 0x2200: 
 			//CCNT (SA-1 CPU Control)
+			CatchUp();
 			if(!(value & 0x20) && _state.Sa1Reset) {
 				//Reset the CPU, and sync cycle count
 				_cpu->Reset();
@@ -250,6 +251,9 @@ void Sa1::CpuRegisterWrite(uint16_t addr, uint8_t value)
 			_state.Sa1Wait = (value & 0x40) != 0;
 			_state.Sa1IrqRequested = (value & 0x80) != 0;
 
+			//While waiting or in reset, Run() only increments the cycle counter
+			_needSync = !_state.Sa1Wait && !_state.Sa1Reset;
+
 			ProcessInterrupts();
 			break;
 
@@ -443,7 +447,11 @@ void Sa1::WriteSa1(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
 	if(_emu->ProcessMemoryWrite<CpuType::Sa1>(addr, value, type)) {
 		IMemoryHandler *handler = _mappings.GetHandler(addr);
-		if(handler) {
+		if(uint8_t* ptr = _mappings.GetWritePointer(addr)) {
+			_lastAccessMemType = handler->GetMemoryType();
+			_openBus = value;
+			ptr[addr & 0xFFF] = value;
+		} else if(handler) {
 			_lastAccessMemType = handler->GetMemoryType();
 			_openBus = value;
 			handler->Write(addr, value);
@@ -457,7 +465,11 @@ uint8_t Sa1::ReadSa1(uint32_t addr, MemoryOperationType type)
 {
 	IMemoryHandler *handler = _mappings.GetHandler(addr);
 	uint8_t value;
-	if(handler) {
+	if(uint8_t* ptr = _mappings.GetReadPointer(addr)) {
+		value = ptr[addr & 0xFFF];
+		_lastAccessMemType = handler->GetMemoryType();
+		_openBus = value;
+	} else if(handler) {
 		value = handler->Read(addr);
 		_lastAccessMemType = handler->GetMemoryType();
 		_openBus = value;
@@ -749,6 +761,7 @@ void Sa1::RunCharConvertType2()
 void Sa1::Reset()
 {
 	_state = {};
+	_needSync = true;
 	CpuRegisterWrite(0x2200, 0x20);
 	CpuRegisterWrite(0x2228, 0xFF);
 
@@ -840,6 +853,10 @@ void Sa1::SaveBattery()
 
 void Sa1::Serialize(Serializer &s)
 {
+	if(s.IsSaving() && s.GetFormat() != SerializeFormat::Map) {
+		CatchUp();
+	}
+
 	SV(_cpu);
 
 	SV(_state.Sa1ResetVector); SV(_state.Sa1IrqVector); SV(_state.Sa1NmiVector); SV(_state.Sa1IrqRequested); SV(_state.Sa1IrqEnabled); SV(_state.Sa1NmiRequested); SV(_state.Sa1NmiEnabled);
@@ -865,5 +882,6 @@ void Sa1::Serialize(Serializer &s)
 		UpdatePrgRomMappings();
 		UpdateSaveRamMappings();
 		ProcessInterrupts();
+		_needSync = !_state.Sa1Wait && !_state.Sa1Reset;
 	}
 }
\ No newline at end of file
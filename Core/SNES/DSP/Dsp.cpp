@@ -52,52 +52,29 @@ void Dsp::Reset()
 	_state.NoiseLfsr = 0x4000;
 
 	_state.Step = 0;
+
+	ResetRateCounters();
 }
 
-bool Dsp::CheckCounter(int32_t rate)
+void Dsp::ResetRateCounters()
 {
-	static uint16_t const rates[32] =
-	{
-		UINT16_MAX,
-		2048, 1536,
-		1280, 1024,  768,
-		640,  512,  384,
-		320,  256,  192,
-		160,  128,   96,
-		80,   64,   48,
-		40,   32,   24,
-		20,   16,   12,
-		10,    8,    6,
-		5,    4,    3,
-		2,
-		1
-	};
-
-	static uint16_t const offsets[32] =
-	{
-		1, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		536, 0, 1040,
-		0,
-		0
-	};
-
-	return (((uint16_t)_state.Counter + offsets[rate]) % rates[rate]) == 0;
+	for(int i = 0; i < 32; i++) {
+		_rateCounters[i] = ((uint16_t)_state.Counter + _counterOffsets[i]) % _counterRates[i];
+	}
 }
 
 void Dsp::UpdateCounter()
 {
 	if(_state.Counter == 0) {
 		_state.Counter = 0x77FF;
+		ResetRateCounters();
 	} else {
 		_state.Counter--;
+
+		//Same result as recalculating (counter + offset) % rate for every rate, without any divisions
+		for(int i = 0; i < 32; i++) {
+			_rateCounters[i] = _rateCounters[i] == 0 ? _counterRates[i] - 1 : _rateCounters[i] - 1;
+		}
 	}
 }
 
@@ -418,4 +395,8 @@ void Dsp::Serialize(Serializer& s)
 	SV(_state.EchoRingBufferAddress);
 	SV(_state.EchoOn);
 	SV(_state.EchoEnabled);
+
+	if(!s.IsSaving()) {
+		ResetRateCounters();
+	}
 }
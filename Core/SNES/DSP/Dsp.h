@@ -20,7 +20,42 @@ private:
 	uint16_t _outSampleCount = 0;
 	int16_t _dspOutput[0x2000] = {};
 
+	static constexpr uint16_t _counterRates[32] = {
+		UINT16_MAX,
+		2048, 1536,
+		1280, 1024,  768,
+		640,  512,  384,
+		320,  256,  192,
+		160,  128,   96,
+		80,   64,   48,
+		40,   32,   24,
+		20,   16,   12,
+		10,    8,    6,
+		5,    4,    3,
+		2,
+		1
+	};
+
+	static constexpr uint16_t _counterOffsets[32] = {
+		1, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		536, 0, 1040,
+		0,
+		0
+	};
+
+	//(Counter + offset) % rate for each of the 32 rates, updated along with the counter
+	uint16_t _rateCounters[32] = {};
+
 	void UpdateCounter();
+	void ResetRateCounters();
 	
 	int32_t CalculateFir(int index, int ch);
 
@@ -47,7 +82,7 @@ public:
 	int16_t* GetSamples() { return _dspOutput; }
 	void ResetOutput() { _outSampleCount = 0; }
 
-	bool CheckCounter(int32_t rate);
+	bool CheckCounter(int32_t rate) { return _rateCounters[rate] == 0; }
 
 	uint8_t Read(uint8_t reg) { return _state.ExternalRegs[reg]; }
 	void Write(uint8_t reg, uint8_t value);
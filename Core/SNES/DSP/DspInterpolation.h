@@ -41,29 +41,27 @@ private:
 	};
 
 public:
-	static int16_t Gauss(int32_t interpolationPos, int16_t* samples, uint8_t bufferPos)
+	//"window" points to the 4 consecutive samples used for interpolation (see DspVoice::_sampleBuffer)
+	static int16_t Gauss(int32_t interpolationPos, int16_t* window)
 	{
-		uint8_t pos = (interpolationPos >> 12) + bufferPos;
 		uint8_t offset = (interpolationPos >> 4) & 0xFF;
 		
 		//"The above 3 wrap at 15 bits signed. The last is added to that, and is clamped rather than wrapped.
 		int32_t out = (int16_t)(
-			((gauss[255 - offset] * (int32_t)samples[pos % 12]) >> 11) +
-			((gauss[511 - offset] * (int32_t)samples[(pos + 1) % 12]) >> 11) +
-			((gauss[256 + offset] * (int32_t)samples[(pos + 2) % 12]) >> 11)
-		) + ((gauss[offset] * (int32_t)samples[(pos + 3) % 12]) >> 11);
+			((gauss[255 - offset] * (int32_t)window[0]) >> 11) +
+			((gauss[511 - offset] * (int32_t)window[1]) >> 11) +
+			((gauss[256 + offset] * (int32_t)window[2]) >> 11)
+		) + ((gauss[offset] * (int32_t)window[3]) >> 11);
 
 		return Dsp::Clamp16(out) & ~0x01;
 	}
 
-	static int16_t Cubic(int32_t interpolationPos, int16_t* samples, uint8_t bufferPos)
+	static int16_t Cubic(int32_t interpolationPos, int16_t* window)
 	{
-		uint8_t pos = (interpolationPos >> 12) + bufferPos;
-
-		float v0 = samples[pos % 12] / 32768.0f;
-		float v1 = samples[(pos + 1) % 12] / 32768.0f;
-		float v2 = samples[(pos + 2) % 12] / 32768.0f;
-		float v3 = samples[(pos + 3) % 12] / 32768.0f;
+		float v0 = window[0] / 32768.0f;
+		float v1 = window[1] / 32768.0f;
+		float v2 = window[2] / 32768.0f;
+		float v3 = window[3] / 32768.0f;
 
 		float a = (v3 - v2) - (v0 - v1);
 		float b = (v0 - v1) - a;
@@ -60,9 +60,11 @@ void DspVoice::DecodeBrrSample()
 		//"The calculations above are preformed in some higher number of bits, clamped to
 		//16 bits at the end and then clipped to 15 bits. This 15-bit value is the value
 		//output and the value used as S(x-1) or S(x-2) as needed for future filter iterations."
-		_sampleBuffer[_bufferPos + i] = Dsp::Clamp16(s) * 2;
+		int16_t sample = Dsp::Clamp16(s) * 2;
+		_sampleBuffer[_bufferPos + i] = sample;
+		_sampleBuffer[_bufferPos + i + 12] = sample;
 		prev2 = prev1;
-		prev1 = _sampleBuffer[_bufferPos + i] >> 1;
+		prev1 = sample >> 1;
 	}
 
 	if(_bufferPos <= 4) {
@@ -72,6 +74,13 @@ void DspVoice::DecodeBrrSample()
 	}
 }
 
+int16_t* DspVoice::GetInterpolationWindow()
+{
+	//pos is at most 15 (7 + 8), so the window never goes past the end of the mirrored buffer
+	uint8_t pos = (_interpolationPos >> 12) + _bufferPos;
+	return _sampleBuffer + (pos >= 12 ? pos - 12 : pos);
+}
+
 void DspVoice::ProcessEnvelope()
 {
 	int32_t env = _envVolume;
@@ -178,7 +187,10 @@ void DspVoice::UpdateOutput(bool right)
 	//"Load and apply VxVOL[L/R] register."
 	int32_t voiceOut = ((int32_t)_shared->VoiceOutput * (int8_t)ReadReg((DspVoiceRegs)((int)DspVoiceRegs::VolLeft + (int)right))) >> 7;
 
-	voiceOut = voiceOut * (int32_t)_cfg->ChannelVolumes[_voiceIndex] / 100;
+	int32_t volume = (int32_t)_cfg->ChannelVolumes[_voiceIndex];
+	if(volume != 100) {
+		voiceOut = voiceOut * volume / 100;
+	}
 
 	_shared->OutSamples[(int)right] = Dsp::Clamp16(_shared->OutSamples[(int)right] + voiceOut);
 
@@ -261,10 +273,11 @@ void DspVoice::Step3c()
 	}
 
 	int32_t output = 0;
+	int16_t* window = GetInterpolationWindow();
 	switch(_cfg->InterpolationType) {
-		case DspInterpolationType::Gauss: output = DspInterpolation::Gauss(_interpolationPos, _sampleBuffer, _bufferPos); break;
-		case DspInterpolationType::Cubic: output = DspInterpolation::Cubic(_interpolationPos, _sampleBuffer, _bufferPos); break;
-		case DspInterpolationType::None: output = _sampleBuffer[((_interpolationPos >> 12) + _bufferPos) % 12]; break;
+		case DspInterpolationType::Gauss: output = DspInterpolation::Gauss(_interpolationPos, window); break;
+		case DspInterpolationType::Cubic: output = DspInterpolation::Cubic(_interpolationPos, window); break;
+		case DspInterpolationType::None: output = window[0]; break;
 	}
 
 	//"If applicable, replace the current sample with the noise sample."
@@ -392,4 +405,7 @@ void DspVoice::Serialize(Serializer& s)
 	SV(_bufferPos);
 
 	SVArray(_sampleBuffer, 12);
+	if(!s.IsSaving()) {
+		memcpy(_sampleBuffer + 12, _sampleBuffer, sizeof(int16_t) * 12);
+	}
 }
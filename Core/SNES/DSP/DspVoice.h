@@ -29,7 +29,9 @@ private:
 	uint8_t _envOut = 0;
 	uint8_t _bufferPos = 0;
 
-	int16_t _sampleBuffer[12] = {};
+	//12 decoded samples, with a copy of them stored right after, so that
+	//the 4-sample interpolation window is always contiguous in memory
+	int16_t _sampleBuffer[24] = {};
 
 	uint8_t ReadReg(DspVoiceRegs reg) { return _regs[(int)reg]; }
 	void WriteReg(DspVoiceRegs reg, uint8_t value) { _regs[(int)reg] = value; }
@@ -37,6 +39,7 @@ private:
 	void DecodeBrrSample();
 	void ProcessEnvelope();
 	void UpdateOutput(bool right);
+	int16_t* GetInterpolationWindow();
 
 public:
 	void Init(uint8_t voiceIndex, Spc* spc, Dsp* dsp, uint8_t* dspVoiceRegs, SnesConfig* cfg);
@@ -20,6 +20,10 @@ public:
 	virtual void PeekBlock(uint32_t addr, uint8_t *output) = 0;
 	virtual void Write(uint32_t addr, uint8_t value) = 0;
 
+	//Returns a pointer to the 4KB page's memory when it can be read (or written) directly, without side effects
+	//Used by MemoryMappings to bypass the virtual Read/Write calls for plain RAM/ROM pages
+	virtual uint8_t* GetDirectPointer(bool forWrite) { return nullptr; }
+
 	__forceinline MemoryType GetMemoryType()
 	{
 		return _memoryType;
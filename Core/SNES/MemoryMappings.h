@@ -9,11 +9,20 @@ class MemoryMappings
 private:
 	IMemoryHandler* _handlers[0x100 * 0x10] = {};
 
+	//Direct pointers to each page's memory (null when the page has side effects and must go through its handler)
+	uint8_t* _readPointers[0x100 * 0x10] = {};
+	uint8_t* _writePointers[0x100 * 0x10] = {};
+
+	void SetHandler(uint32_t page, IMemoryHandler* handler);
+
 public:
 	void RegisterHandler(uint8_t startBank, uint8_t endBank, uint16_t startPage, uint16_t endPage, vector<unique_ptr<IMemoryHandler>>& handlers, uint16_t pageIncrement = 0, uint16_t startPageNumber = 0);
 	void RegisterHandler(uint8_t startBank, uint8_t endBank, uint16_t startAddr, uint16_t endAddr, IMemoryHandler* handler);
 
-	IMemoryHandler* GetHandler(uint32_t addr);
+	__forceinline IMemoryHandler* GetHandler(uint32_t addr) { return _handlers[addr >> 12]; }
+	__forceinline uint8_t* GetReadPointer(uint32_t addr) { return _readPointers[addr >> 12]; }
+	__forceinline uint8_t* GetWritePointer(uint32_t addr) { return _writePointers[addr >> 12]; }
+
 	AddressInfo GetAbsoluteAddress(uint32_t addr);
 	int GetRelativeAddress(AddressInfo& absAddress, uint8_t startBank = 0);
 
@@ -52,6 +52,12 @@ public:
 		_ram[addr & _mask] = value;
 	}
 
+	uint8_t* GetDirectPointer(bool forWrite) override
+	{
+		//Mirrored pages (smaller than 4KB) can't be accessed directly
+		return _mask == 0xFFF ? _ram : nullptr;
+	}
+
 	AddressInfo GetAbsoluteAddress(uint32_t address) override
 	{
 		AddressInfo info;
@@ -10,4 +10,9 @@ public:
 	void Write(uint32_t addr, uint8_t value) override
 	{
 	}
+
+	uint8_t* GetDirectPointer(bool forWrite) override
+	{
+		return forWrite ? nullptr : RamHandler::GetDirectPointer(false);
+	}
 };
\ No newline at end of file
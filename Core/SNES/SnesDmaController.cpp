@@ -65,6 +65,12 @@ void SnesDmaController::CopyDmaByte(uint32_t addressBusA, uint16_t addressBusB,
 	}
 }
 
+bool SnesDmaController::IsPpuDataPort(uint16_t addressBusB)
+{
+	//OAMDATA, VMDATAL, VMDATAH, CGDATA
+	return addressBusB == 0x2104 || addressBusB == 0x2118 || addressBusB == 0x2119 || addressBusB == 0x2122;
+}
+
 void SnesDmaController::RunDma(DmaChannelConfig &channel)
 {
 	if(!channel.DmaActive) {
@@ -77,14 +83,18 @@ void SnesDmaController::RunDma(DmaChannelConfig &channel)
 
 	const uint8_t *transferOffsets = _transferOffset[channel.TransferMode];
 
+	//Bulk uploads to VRAM/CGRAM/OAM can bypass the bus B register lookup and the memory hooks when no debugger or cheats are active
+	bool allowFastTransfer = !channel.InvertDirection && _memoryManager->CanSkipDmaHooks();
+
 	uint8_t i = 0;
 	do {
 		//Manual DMA transfers run to the end of the transfer when started
-		CopyDmaByte(
-			(channel.SrcBank << 16) | channel.SrcAddress,
-			0x2100 | (channel.DestAddress + transferOffsets[i & 0x03]),
-			channel.InvertDirection
-		);
+		uint16_t addressBusB = 0x2100 | (channel.DestAddress + transferOffsets[i & 0x03]);
+		if(allowFastTransfer && IsPpuDataPort(addressBusB)) {
+			_memoryManager->TransferDmaToPpu((channel.SrcBank << 16) | channel.SrcAddress, addressBusB);
+		} else {
+			CopyDmaByte((channel.SrcBank << 16) | channel.SrcAddress, addressBusB, channel.InvertDirection);
+		}
 
 		if(!channel.FixedTransfer) {
 			channel.SrcAddress += channel.Decrement ? -1 : 1;
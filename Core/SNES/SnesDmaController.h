@@ -25,6 +25,7 @@ private:
 	SnesMemoryManager *_memoryManager;
 	
 	void CopyDmaByte(uint32_t addressBusA, uint16_t addressBusB, bool fromBtoA);
+	__forceinline bool IsPpuDataPort(uint16_t addressBusB);
 
 	void RunDma(DmaChannelConfig &channel);
 	
@@ -242,7 +242,12 @@ uint8_t SnesMemoryManager::Read(uint32_t addr, MemoryOperationType type)
 
 	uint8_t value;
 	IMemoryHandler *handler = _mappings.GetHandler(addr);
-	if(handler) {
+	if(uint8_t* ptr = _mappings.GetReadPointer(addr)) {
+		//Plain RAM/ROM page, read it directly
+		value = ptr[addr & 0xFFF];
+		_memTypeBusA = handler->GetMemoryType();
+		_openBus = value;
+	} else if(handler) {
 		value = handler->Read(addr);
 		_memTypeBusA = handler->GetMemoryType();
 		_openBus = value;
@@ -264,9 +269,24 @@ uint8_t SnesMemoryManager::ReadDma(uint32_t addr, bool forBusA)
 	_cpu->DetectNmiSignalEdge();
 	IncMasterClock4();
 
+	uint8_t value = ReadDmaValue(addr, forBusA);
+	if(_cheatManager->HasCheats<CpuType::Snes>()) {
+		_cheatManager->ApplyCheat<CpuType::Snes>(addr, value);
+	}
+	_emu->ProcessMemoryRead<CpuType::Snes>(addr, value, MemoryOperationType::DmaRead);
+	return value;
+}
+
+uint8_t SnesMemoryManager::ReadDmaValue(uint32_t addr, bool forBusA)
+{
 	uint8_t value;
 	IMemoryHandler* handler = _mappings.GetHandler(addr);
-	if(handler) {
+	if(uint8_t* ptr = _mappings.GetReadPointer(addr)) {
+		//Plain RAM/ROM page, read it directly
+		value = ptr[addr & 0xFFF];
+		_memTypeBusA = handler->GetMemoryType();
+		_openBus = value;
+	} else if(handler) {
 		if(forBusA && handler == _registerHandlerB.get() && (addr & 0xFF00) == 0x2100) {
 			//Trying to read from bus B using bus A returns open bus
 			value = _openBus;
@@ -290,13 +310,28 @@ uint8_t SnesMemoryManager::ReadDma(uint32_t addr, bool forBusA)
 		value = _openBus;
 		LogDebug("[Debug] Read - missing handler: $" + HexUtilities::ToHex(addr));
 	}
-	if(_cheatManager->HasCheats<CpuType::Snes>()) {
-		_cheatManager->ApplyCheat<CpuType::Snes>(addr, value);
-	}
-	_emu->ProcessMemoryRead<CpuType::Snes>(addr, value, MemoryOperationType::DmaRead);
 	return value;
 }
 
+bool SnesMemoryManager::CanSkipDmaHooks()
+{
+	return !_emu->IsDebugging() && !_cheatManager->HasCheats<CpuType::Snes>();
+}
+
+void SnesMemoryManager::TransferDmaToPpu(uint32_t addressBusA, uint16_t addressBusB)
+{
+	//Same timing and side effects as ReadDma + WriteDma, without the debugger/cheat hooks
+	//and without going through the bus B register handler (only used when CanSkipDmaHooks() is true)
+	_cpu->DetectNmiSignalEdge();
+	IncMasterClock4();
+	uint8_t value = ReadDmaValue(addressBusA, true);
+
+	_cpu->DetectNmiSignalEdge();
+	IncMasterClock4();
+	_ppu->Write(addressBusB, value);
+	_openBus = value;
+}
+
 uint8_t SnesMemoryManager::Peek(uint32_t addr)
 {
 	return _mappings.Peek(addr);
@@ -317,7 +352,10 @@ void SnesMemoryManager::Write(uint32_t addr, uint8_t value, MemoryOperationType
 	IncrementMasterClockValue(_cpuSpeed);
 	if(_emu->ProcessMemoryWrite<CpuType::Snes>(addr, value, type)) {
 		IMemoryHandler* handler = _mappings.GetHandler(addr);
-		if(handler) {
+		if(uint8_t* ptr = _mappings.GetWritePointer(addr)) {
+			ptr[addr & 0xFFF] = value;
+			_memTypeBusA = handler->GetMemoryType();
+		} else if(handler) {
 			handler->Write(addr, value);
 			_memTypeBusA = handler->GetMemoryType();
 		} else {
@@ -63,6 +63,8 @@ private:
 
 	void ProcessEvent();
 
+	uint8_t ReadDmaValue(uint32_t addr, bool forBusA);
+
 public:
 	void Initialize(SnesConsole* console);
 	virtual ~SnesMemoryManager();
@@ -81,6 +83,9 @@ public:
 	uint8_t Read(uint32_t addr, MemoryOperationType type);
 	uint8_t ReadDma(uint32_t addr, bool forBusA);
 
+	bool CanSkipDmaHooks();
+	void TransferDmaToPpu(uint32_t addressBusA, uint16_t addressBusB);
+
 	uint8_t Peek(uint32_t addr);
 	uint16_t PeekWord(uint32_t addr);
 	void PeekBlock(uint32_t addr, uint8_t * dest);
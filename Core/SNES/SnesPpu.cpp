@@ -13,7 +13,6 @@
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/Video/VideoDecoder.h"
-#include "Shared/Video/VideoRenderer.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/MessageManager.h"
@@ -492,18 +491,7 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock)
 			_timeOver = false;
 			_emu->ProcessEvent(EventType::StartFrame);
 
-			_skipRender = (
-				!_settings->GetSnesConfig().DisableFrameSkipping &&
-				(!_interlacedFrame || (_frameCount & 0x02)) &&
-				!_emu->GetRewindManager()->IsRewinding() &&
-				!_emu->GetVideoRenderer()->IsRecording() &&
-				(_settings->GetEmulationSpeed() == 0 || _settings->GetEmulationSpeed() > 150) &&
-				_frameSkipTimer.GetElapsedMS() < 10
-			);
-			
-			if(_emu->IsRunAheadFrame()) {
-				_skipRender = true;
-			}
+			_skipRender = _frameSkip.ProcessStartFrame(_emu, !_settings->GetSnesConfig().DisableFrameSkipping && (!_interlacedFrame || (_frameCount & 0x02)));
 
 			//Ensure the SPC is re-enabled for the next frame
 			_spc->SetSpcState(true);
@@ -1181,20 +1169,35 @@ void SnesPpu::RenderTilemapMode7()
 	
 	uint8_t pixelFlags = ((_state.ColorMathEnabled >> layerIndex) & 0x01) ? PixelFlags::AllowColorMath : 0;
 
+	uint64_t mainWindowMask[4];
+	uint64_t subWindowMask[4];
+	GetWindowMask<layerIndex>(mainWindowCount, mainWindowMask);
+	GetWindowMask<layerIndex>(subWindowCount, subWindowMask);
+
+	//Calculate the map coordinates for the whole segment first (this loop has no dependencies between pixels and gets vectorized)
+	int32_t xOffsets[256];
+	int32_t yOffsets[256];
+	for(int x = _drawStartX; x <= _drawEndX; x++) {
+		int32_t step = x - _drawStartX;
+		xOffsets[x] = (xValue + xStep * step) >> 8;
+		yOffsets[x] = (yValue + yStep * step) >> 8;
+	}
+
+	bool largeMap = _state.Mode7.LargeMap;
+	bool fillWithTile0 = _state.Mode7.FillWithTile0;
+
 	for(int x = _drawStartX; x <= _drawEndX; x++) {
-		int32_t xOffset = xValue >> 8;
-		int32_t yOffset = yValue >> 8;
-		xValue += xStep;
-		yValue += yStep;
+		int32_t xOffset = xOffsets[x];
+		int32_t yOffset = yOffsets[x];
 
 		uint8_t tileIndex;
-		if(!_state.Mode7.LargeMap) {
+		if(!largeMap) {
 			yOffset &= 0x3FF;
 			xOffset &= 0x3FF;
 			tileIndex = (uint8_t)_vram[((yOffset & ~0x07) << 4) | (xOffset >> 3)];
 		} else {
 			if(yOffset < 0 || yOffset > 0x3FF || xOffset < 0 || xOffset > 0x3FF) {
-				if(_state.Mode7.FillWithTile0) {
+				if(fillWithTile0) {
 					tileIndex = 0;
 				} else {
 					//Draw nothing for this pixel, we're outside the map
@@ -1238,11 +1241,11 @@ void SnesPpu::RenderTilemapMode7()
 				paletteColor = _cgram[colorIndex];
 			}
 			
-			if(drawMain && (_mainScreenFlags[x] & 0x0F) < priority && !ProcessMaskWindow<layerIndex>(mainWindowCount, x)) {
+			if(drawMain && (_mainScreenFlags[x] & 0x0F) < priority && !((mainWindowMask[x >> 6] >> (x & 0x3F)) & 0x01)) {
 				DrawMainPixel(x, paletteColor, priority | pixelFlags);
 			} 
 
-			if(drawSub && _subScreenPriority[x] < priority && !ProcessMaskWindow<layerIndex>(subWindowCount, x)) {
+			if(drawSub && _subScreenPriority[x] < priority && !((subWindowMask[x >> 6] >> (x & 0x3F)) & 0x01)) {
 				DrawSubPixel(x, paletteColor, priority);
 			}
 		}
@@ -1270,78 +1273,82 @@ void SnesPpu::ApplyColorMath()
 	uint8_t activeWindowCount = (uint8_t)_state.Window[0].ActiveLayers[SnesPpu::ColorWindowIndex] + (uint8_t)_state.Window[1].ActiveLayers[SnesPpu::ColorWindowIndex];
 	bool hiResMode = _state.HiResMode || _state.BgMode == 5 || _state.BgMode == 6;
 
+	//Resolve the clip/prevent modes against the color window once for the whole scanline (1 bit per pixel)
+	uint64_t windowMask[4];
+	GetWindowMask<SnesPpu::ColorWindowIndex>(activeWindowCount, windowMask);
+
+	auto getModeMask = [](ColorWindowMode mode, uint64_t window) -> uint64_t {
+		switch(mode) {
+			default:
+			case ColorWindowMode::Never: return 0;
+			case ColorWindowMode::OutsideWindow: return ~window;
+			case ColorWindowMode::InsideWindow: return window;
+			case ColorWindowMode::Always: return ~0ULL;
+		}
+	};
+
+	uint64_t clipMask[4];
+	uint64_t preventMask[4];
+	for(int i = 0; i < 4; i++) {
+		clipMask[i] = getModeMask(_state.ColorMathClipMode, windowMask[i]);
+		preventMask[i] = getModeMask(_state.ColorMathPreventMode, windowMask[i]);
+	}
+
 	if(hiResMode) {
 		for(int x = _drawStartX; x <= _drawEndX; x++) {
-			bool isInsideWindow = ProcessMaskWindow<SnesPpu::ColorWindowIndex>(activeWindowCount, x);
+			bool clipToBlack = (clipMask[x >> 6] >> (x & 0x3F)) & 0x01;
+			bool preventColorMath = (preventMask[x >> 6] >> (x & 0x3F)) & 0x01;
 
 			//Keep original subscreen color, which is used to apply color math to the main screen after
 			uint16_t subPixel = _subScreenBuffer[x];
 			//Apply the color math based on the previous main pixel
 			uint16_t prevMainPixel = x > 0 ? _mainScreenBuffer[x - 1] : 0;
 			int prevX = x > 0 ? x - 1 : 0;
-			ApplyColorMathToPixel(_subScreenBuffer[x], prevMainPixel, prevX, isInsideWindow);
+			ApplyColorMathToPixel(_subScreenBuffer[x], prevMainPixel, prevX, clipToBlack, preventColorMath);
 
-			ApplyColorMathToPixel(_mainScreenBuffer[x], subPixel, x, isInsideWindow);
+			ApplyColorMathToPixel(_mainScreenBuffer[x], subPixel, x, clipToBlack, preventColorMath);
 		}
 	} else {
 		for(int x = _drawStartX; x <= _drawEndX; x++) {
-			bool isInsideWindow = ProcessMaskWindow<SnesPpu::ColorWindowIndex>(activeWindowCount, x);
-			ApplyColorMathToPixel(_mainScreenBuffer[x], _subScreenBuffer[x], x, isInsideWindow);
+			bool clipToBlack = (clipMask[x >> 6] >> (x & 0x3F)) & 0x01;
+			bool preventColorMath = (preventMask[x >> 6] >> (x & 0x3F)) & 0x01;
+			ApplyColorMathToPixel(_mainScreenBuffer[x], _subScreenBuffer[x], x, clipToBlack, preventColorMath);
 		}
 	}
 }
 
-void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool isInsideWindow)
-{
-	uint8_t halfShift = (uint8_t)_state.ColorMathHalveResult;
+//The 3 color channels are spread 10 bits apart in a 32-bit value, which leaves room for each channel's
+//carry/borrow bit, so all 3 channels can be added/subtracted, halved and clamped at the same time
+static constexpr uint32_t ColorChannelMask = 0x1F | (0x1F << 10) | (0x1F << 20);
+static constexpr uint32_t ColorCarryMask = 0x20 | (0x20 << 10) | (0x20 << 20);
 
-	//Set color to black as needed based on clip mode
-	switch(_state.ColorMathClipMode) {
-		default:
-		case ColorWindowMode::Never: break;
+static __forceinline uint32_t SpreadColor(uint16_t color)
+{
+	return (color & 0x1F) | ((color & 0x3E0) << 5) | ((color & 0x7C00) << 10);
+}
 
-		case ColorWindowMode::OutsideWindow:
-			if(!isInsideWindow) {
-				pixelA = 0;
-				halfShift = 0;
-			}
-			break;
+static __forceinline uint16_t PackColor(uint32_t color)
+{
+	return (color & 0x1F) | ((color >> 5) & 0x3E0) | ((color >> 10) & 0x7C00);
+}
 
-		case ColorWindowMode::InsideWindow:
-			if(isInsideWindow) {
-				pixelA = 0;
-				halfShift = 0;
-			}
-			break;
+void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool clipToBlack, bool preventColorMath)
+{
+	uint8_t halfShift = (uint8_t)_state.ColorMathHalveResult;
 
-		case ColorWindowMode::Always: pixelA = 0; break;
+	//Set color to black as needed based on clip mode
+	if(clipToBlack) {
+		pixelA = 0;
+		if(_state.ColorMathClipMode != ColorWindowMode::Always) {
+			halfShift = 0;
+		}
 	}
 
-	if(!(_mainScreenFlags[x] & PixelFlags::AllowColorMath)) {
+	if(!(_mainScreenFlags[x] & PixelFlags::AllowColorMath) || preventColorMath) {
 		//Color math doesn't apply to this pixel
 		return;
 	}
 
-	//Prevent color math as needed based on mode
-	switch(_state.ColorMathPreventMode) {
-		default:
-		case ColorWindowMode::Never: break;
-
-		case ColorWindowMode::OutsideWindow:
-			if(!isInsideWindow) {
-				return;
-			}
-			break;
-
-		case ColorWindowMode::InsideWindow:
-			if(isInsideWindow) {
-				return;
-			}
-			break;
-
-		case ColorWindowMode::Always: return;
-	}
-
 	uint16_t otherPixel;
 	if(_state.ColorMathAddSubscreen) {
 		if(_subScreenPriority[x] > 0) {
@@ -1355,20 +1362,20 @@ void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bo
 		otherPixel = _state.FixedColor;
 	}
 
-	constexpr unsigned int mask = 0x1F;
+	uint32_t a = SpreadColor(pixelA);
+	uint32_t b = SpreadColor(otherPixel);
+	uint32_t result;
 	if(_state.ColorMathSubtractMode) {
-		uint16_t r = std::max((int)((pixelA & mask) - (otherPixel & mask)), 0) >> halfShift;
-		uint16_t g = std::max((int)(((pixelA >> 5U) & mask) - ((otherPixel >> 5U) & mask)), 0) >> halfShift;
-		uint16_t b = std::max((int)(((pixelA >> 10U) & mask) - ((otherPixel >> 10U) & mask)), 0) >> halfShift;
-
-		pixelA = r | (g << 5U) | (b << 10U);
+		//The carry bit stays set for channels that didn't go below 0, clear the other channels
+		result = (a | ColorCarryMask) - b;
+		result &= ((result & ColorCarryMask) >> 5) * 0x1F;
+		result >>= halfShift;
 	} else {
-		uint16_t r = std::min(((pixelA & mask) + (otherPixel & mask)) >> halfShift, mask);
-		uint16_t g = std::min((((pixelA >> 5U) & mask) + ((otherPixel >> 5U) & mask)) >> halfShift, mask);
-		uint16_t b = std::min((((pixelA >> 10U) & mask) + ((otherPixel >> 10U) & mask)) >> halfShift, mask);
-
-		pixelA = r | (g << 5U) | (b << 10U);
+		//Saturate channels that went above 31
+		result = (a + b) >> halfShift;
+		result |= ((result & ColorCarryMask) >> 5) * 0x1F;
 	}
+	pixelA = PackColor(result & ColorChannelMask);
 }
 
 template<bool forMainScreen>
@@ -1476,6 +1483,33 @@ bool SnesPpu::ProcessMaskWindow(uint8_t activeWindowCount, int x)
 	return false;
 }
 
+template<uint8_t layerIndex>
+void SnesPpu::GetWindowMask(uint8_t activeWindowCount, uint64_t mask[4])
+{
+	switch(activeWindowCount) {
+		case 1:
+			_state.Window[_state.Window[0].ActiveLayers[layerIndex] ? 0 : 1].GetMask<layerIndex>(mask);
+			return;
+
+		case 2: {
+			uint64_t mask2[4];
+			_state.Window[0].GetMask<layerIndex>(mask);
+			_state.Window[1].GetMask<layerIndex>(mask2);
+			for(int i = 0; i < 4; i++) {
+				switch(_state.MaskLogic[layerIndex]) {
+					default:
+					case WindowMaskLogic::Or: mask[i] |= mask2[i]; break;
+					case WindowMaskLogic::And: mask[i] &= mask2[i]; break;
+					case WindowMaskLogic::Xor: mask[i] ^= mask2[i]; break;
+					case WindowMaskLogic::Xnor: mask[i] = ~(mask[i] ^ mask2[i]); break;
+				}
+			}
+			return;
+		}
+	}
+	memset(mask, 0, sizeof(uint64_t) * 4);
+}
+
 void SnesPpu::ProcessWindowMaskSettings(uint8_t value, uint8_t offset)
 {
 	_state.Window[0].ActiveLayers[0 + offset] = (value & 0x02) != 0;
@@ -1510,11 +1544,9 @@ void SnesPpu::SendFrame()
 	}
 	_needFullFrame = false;
 
-	RenderedFrame frame(_currentBuffer, width, height, _useHighResOutput ? 0.5 : 1.0, _frameCount, _console->GetControlManager()->GetPortStates());
-	_emu->GetVideoDecoder()->UpdateFrame(frame, isRewinding, isRewinding);
-
 	if(!_skipRender) {
-		_frameSkipTimer.Reset();
+		RenderedFrame frame(_currentBuffer, width, height, _useHighResOutput ? 0.5 : 1.0, _frameCount, _console->GetControlManager()->GetPortStates());
+		_emu->GetVideoDecoder()->UpdateFrame(frame, isRewinding, isRewinding);
 	}
 }
 
@@ -2,7 +2,7 @@
 #include "pch.h"
 #include "SNES/SnesPpuTypes.h"
 #include "Utilities/ISerializable.h"
-#include "Utilities/Timer.h"
+#include "Shared/Video/FrameSkipHelper.h"
 
 class Emulator;
 class SnesConsole;
@@ -104,7 +104,7 @@ private:
 	uint16_t _latchRequestX = 0;
 	uint16_t _latchRequestY = 0;
 
-	Timer _frameSkipTimer;
+	FrameSkipHelper _frameSkip;
 	bool _skipRender = false;
 	uint8_t _configVisibleLayers = 0xFF;
 
@@ -178,7 +178,7 @@ private:
 	__forceinline void DrawSubPixel(uint8_t x, uint16_t color, uint8_t priority);
 
 	void ApplyColorMath();
-	void ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool isInsideWindow);
+	void ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool clipToBlack, bool preventColorMath);
 	
 	template<bool forMainScreen>
 	void ApplyBrightness();
@@ -189,6 +189,9 @@ private:
 	template<uint8_t layerIndex>
 	bool ProcessMaskWindow(uint8_t activeWindowCount, int x);
 
+	template<uint8_t layerIndex>
+	void GetWindowMask(uint8_t activeWindowCount, uint64_t mask[4]);
+
 	void ProcessWindowMaskSettings(uint8_t value, uint8_t offset);
 
 	void UpdateVramReadBuffer();
@@ -122,6 +122,22 @@ struct WindowConfig
 			}
 		}
 	}
+
+	//Same result as PixelNeedsMasking, for all 256 pixels at once (1 bit per pixel)
+	template<uint8_t layerIndex>
+	void GetMask(uint64_t mask[4])
+	{
+		for(int i = 0; i < 4; i++) {
+			int start = Left > (i << 6) ? Left : (i << 6);
+			int end = Right < (i << 6) + 63 ? Right : (i << 6) + 63;
+			uint64_t bits = 0;
+			if(Left <= Right && start <= end) {
+				int length = end - start + 1;
+				bits = (length == 64 ? ~0ULL : ((1ULL << length) - 1)) << (start & 0x3F);
+			}
+			mask[i] = InvertedLayers[layerIndex] ? ~bits : bits;
+		}
+	}
 };
 
 struct SnesPpuState : public BaseState
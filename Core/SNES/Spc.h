@@ -293,6 +293,9 @@ public:
 
 	void SetSpcState(bool enabled);
 
+	//Catches up the SPC/DSP to the main CPU's master clock. Called when the S-CPU accesses $2140-$2143, at the end of
+	//each frame (before the audio buffer is sent), when saving states, before SetSpcState() disables the SPC, and
+	//on every PPU cycle while the SPC debugger or trace logger is enabled (SnesDebugger::ProcessPpuCycle)
 	void Run();
 	void Reset();
 
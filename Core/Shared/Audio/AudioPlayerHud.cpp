@@ -188,11 +188,11 @@ uint32_t AudioPlayerHud::GetVolume()
 	return _emu->GetSettings()->GetAudioPlayerConfig().Volume;
 }
 
-void AudioPlayerHud::ProcessSamples(int16_t* samples, size_t sampleCount, uint32_t sampleRate)
+void AudioPlayerHud::ProcessSamples(float* samples, size_t sampleCount, uint32_t sampleRate)
 {
 	_sampleRate = sampleRate;
 	for(int i = 0; i < sampleCount; i++) {
-		_samples.push_back((samples[i * 2] + samples[i * 2 + 1]) / 2);
+		_samples.push_back((int16_t)std::clamp((samples[i * 2] + samples[i * 2 + 1]) / 2, -32768.0f, 32767.0f));
 		if(_samples.size() > N) {
 			_samples.pop_front();
 		}
@@ -37,5 +37,5 @@ public:
 
 	void Draw();
 	uint32_t GetVolume();
-	void ProcessSamples(int16_t* samples, size_t sampleCount, uint32_t sampleRate);
+	void ProcessSamples(float* samples, size_t sampleCount, uint32_t sampleRate);
 };
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "pch.h"
+#include "Shared/Audio/AudioTelemetry.h"
+
+AudioTelemetry::AudioTelemetry()
+{
+	for(int i = 0; i < AudioTelemetryData::BinCount; i++) {
+		_callbackJitter[i] = 0;
+	}
+	_callbackCount = 0;
+}
+
+AudioTelemetry::~AudioTelemetry()
+{
+	StopLog();
+}
+
+int AudioTelemetry::GetBin(double value, double binSize, int offset)
+{
+	return std::clamp((int)std::floor(value / binSize) + offset, 0, AudioTelemetryData::BinCount - 1);
+}
+
+void AudioTelemetry::RecordFrame(double latencyMs, uint32_t totalUnderrunCount, uint32_t totalOverrunCount)
+{
+	_current.FillLevel[GetBin(latencyMs, 10.0)]++;
+	_current.FrameCount++;
+
+	if(totalUnderrunCount < _prevUnderrunCount || totalOverrunCount < _prevOverrunCount) {
+		//The device's stats were reset
+		_prevUnderrunCount = 0;
+		_prevOverrunCount = 0;
+	}
+	_current.UnderrunCount += totalUnderrunCount - _prevUnderrunCount;
+	_current.OverrunCount += totalOverrunCount - _prevOverrunCount;
+	_prevUnderrunCount = totalUnderrunCount;
+	_prevOverrunCount = totalOverrunCount;
+
+	if(_timer.GetElapsedMS() >= 1000) {
+		EndSecond();
+	}
+}
+
+void AudioTelemetry::RecordRateAdjustment(double rateAdjustment)
+{
+	_current.RateAdjustment[GetBin(rateAdjustment - 1.0, 0.0005, AudioTelemetryData::BinCount / 2)]++;
+}
+
+void AudioTelemetry::RecordStreamSeeks(uint32_t seekCount, double totalLatencyUs, double maxLatencyUs)
+{
+	if(seekCount > 0) {
+		_current.StreamSeekCount += seekCount;
+		_current.StreamSeekTotalLatencyUs += (uint32_t)totalLatencyUs;
+		_current.StreamSeekMaxLatencyUs = std::max(_current.StreamSeekMaxLatencyUs, (uint32_t)maxLatencyUs);
+	}
+}
+
+void AudioTelemetry::RecordCallback()
+{
+	high_resolution_clock::time_point now = high_resolution_clock::now();
+	if(_callbackCount.fetch_add(1, std::memory_order_relaxed) > 0) {
+		double interval = duration<double, std::milli>(now - _prevCallbackTime).count();
+		if(_prevCallbackInterval >= 0) {
+			_callbackJitter[GetBin(std::abs(interval - _prevCallbackInterval), 1.0)].fetch_add(1, std::memory_order_relaxed);
+		}
+		_prevCallbackInterval = interval;
+	}
+	_prevCallbackTime = now;
+}
+
+void AudioTelemetry::EndSecond()
+{
+	for(int i = 0; i < AudioTelemetryData::BinCount; i++) {
+		_current.CallbackJitter[i] = _callbackJitter[i].exchange(0, std::memory_order_relaxed);
+	}
+	_current.CallbackCount = _callbackCount.exchange(0, std::memory_order_relaxed);
+
+	auto lock = _lock.AcquireSafe();
+	_lastSecond = _current;
+	_secondIndex++;
+	if(_log) {
+		WriteLogEntry();
+	}
+
+	_current = {};
+	_timer.Reset();
+}
+
+void AudioTelemetry::WriteLogEntry()
+{
+	ofstream& log = *_log;
+	log << _secondIndex << "," << _lastSecond.FrameCount << "," << _lastSecond.CallbackCount << "," << _lastSecond.UnderrunCount << "," << _lastSecond.OverrunCount;
+	log << "," << _lastSecond.StreamSeekCount << "," << _lastSecond.StreamSeekMaxLatencyUs << "," << _lastSecond.StreamSeekTotalLatencyUs;
+	for(uint32_t count : _lastSecond.FillLevel) {
+		log << "," << count;
+	}
+	for(uint32_t count : _lastSecond.CallbackJitter) {
+		log << "," << count;
+	}
+	for(uint32_t count : _lastSecond.RateAdjustment) {
+		log << "," << count;
+	}
+	log << "\n";
+}
+
+AudioTelemetryData AudioTelemetry::GetLastSecond()
+{
+	auto lock = _lock.AcquireSafe();
+	return _lastSecond;
+}
+
+bool AudioTelemetry::StartLog(string filename)
+{
+	auto lock = _lock.AcquireSafe();
+	_log.reset(new ofstream(filename, ios::out | ios::trunc));
+	if(!_log->good()) {
+		_log.reset();
+		return false;
+	}
+
+	ofstream& log = *_log;
+	log << "Second,Frames,Callbacks,Underruns,Overruns,StreamSeeks,StreamSeekMaxUs,StreamSeekTotalUs";
+	for(int i = 0; i < AudioTelemetryData::BinCount; i++) {
+		log << ",Fill" << (i * 10) << "ms";
+	}
+	for(int i = 0; i < AudioTelemetryData::BinCount; i++) {
+		log << ",Jitter" << i << "ms";
+	}
+	for(int i = 0; i < AudioTelemetryData::BinCount; i++) {
+		log << ",Rate" << std::showpos << std::fixed << std::setprecision(2) << (i - AudioTelemetryData::BinCount / 2) * 0.05 << std::noshowpos << "%";
+	}
+	log << "\n";
+	return true;
+}
+
+void AudioTelemetry::StopLog()
+{
+	auto lock = _lock.AcquireSafe();
+	_log.reset();
+}
+
+bool AudioTelemetry::IsLogging()
+{
+	auto lock = _lock.AcquireSafe();
+	return _log != nullptr;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/Timer.h"
+#include "Utilities/SimpleLock.h"
+
+struct AudioTelemetryData
+{
+	static constexpr int BinCount = 16;
+
+	//Number of frames where the amount of buffered audio was in each 10ms range (last bin: 150ms+)
+	uint32_t FillLevel[BinCount] = {};
+
+	//Number of audio callbacks where the interval since the previous callback differed from the
+	//previous interval by each 1ms range (last bin: 15ms+)
+	uint32_t CallbackJitter[BinCount] = {};
+
+	//Number of resampler updates where the rate adjustment was in each 0.05% range,
+	//bin 8 is [1.0, 1.0005), bin 0 is below -0.35% and bin 15 is +0.35% or more
+	uint32_t RateAdjustment[BinCount] = {};
+
+	uint32_t UnderrunCount = 0;
+	uint32_t OverrunCount = 0;
+	uint32_t FrameCount = 0;
+	uint32_t CallbackCount = 0;
+
+	//Seeks in streamed audio/data files (e.g MSU-1), and how long it took for the first read at the new position
+	uint32_t StreamSeekCount = 0;
+	uint32_t StreamSeekMaxLatencyUs = 0;
+	uint32_t StreamSeekTotalLatencyUs = 0;
+};
+
+//Per-second histograms of audio buffer/resampler state, to help tune low latency setups
+class AudioTelemetry
+{
+private:
+	AudioTelemetryData _current = {};
+	AudioTelemetryData _lastSecond = {};
+	uint32_t _secondIndex = 0;
+	Timer _timer;
+
+	//Callback data is recorded on the audio thread
+	atomic<uint32_t> _callbackJitter[AudioTelemetryData::BinCount];
+	atomic<uint32_t> _callbackCount;
+	high_resolution_clock::time_point _prevCallbackTime;
+	double _prevCallbackInterval = -1;
+
+	uint32_t _prevUnderrunCount = 0;
+	uint32_t _prevOverrunCount = 0;
+
+	SimpleLock _lock;
+	unique_ptr<ofstream> _log;
+
+	static int GetBin(double value, double binSize, int offset = 0);
+	void EndSecond();
+	void WriteLogEntry();
+
+public:
+	AudioTelemetry();
+	~AudioTelemetry();
+
+	//Called on the emulation thread
+	void RecordFrame(double latencyMs, uint32_t totalUnderrunCount, uint32_t totalOverrunCount);
+	void RecordRateAdjustment(double rateAdjustment);
+	void RecordStreamSeeks(uint32_t seekCount, double totalLatencyUs, double maxLatencyUs);
+
+	//Called on the audio device's callback thread
+	void RecordCallback();
+
+	AudioTelemetryData GetLastSecond();
+
+	bool StartLog(string filename);
+	void StopLog();
+	bool IsLogging();
+};
@@ -11,7 +11,18 @@ void BaseSoundManager::ProcessLatency(uint32_t readPosition, uint32_t writePosit
 		cursorGap = writePosition - readPosition;
 	}
 
-	_cursorGaps[_cursorGapIndex] = cursorGap;
+	ProcessLatency(cursorGap);
+}
+
+void BaseSoundManager::ProcessLatency(uint32_t bufferedBytes)
+{
+	//Record the amount of buffered data once per frame
+	uint32_t bytesPerSample = _isStereo ? 4 : 2;
+	if(_sampleRate > 0) {
+		_telemetry.RecordFrame((bufferedBytes / bytesPerSample) / (double)_sampleRate * 1000, _bufferUnderrunEventCount, _bufferOverrunEventCount);
+	}
+
+	_cursorGaps[_cursorGapIndex] = bufferedBytes;
 	_cursorGapIndex = (_cursorGapIndex + 1) % 60;
 	if(_cursorGapIndex == 0) {
 		_cursorGapFilled = true;
@@ -20,8 +31,6 @@ void BaseSoundManager::ProcessLatency(uint32_t readPosition, uint32_t writePosit
 	if(_cursorGapFilled) {
 		//Once we have 60+ frames worth of data to work with, adjust playback frequency by +/- 0.5%
 		//To speed up or slow down playback in order to reach our latency goal.
-		uint32_t bytesPerSample = _isStereo ? 4 : 2;
-
 		int32_t gapSum = 0;
 		for(int i = 0; i < 60; i++) {
 			gapSum += _cursorGaps[i];
@@ -37,14 +46,21 @@ AudioStatistics BaseSoundManager::GetStatistics()
 	AudioStatistics stats;
 	stats.AverageLatency = _averageLatency;
 	stats.BufferUnderrunEventCount = _bufferUnderrunEventCount;
+	stats.BufferOverrunEventCount = _bufferOverrunEventCount;
 	stats.BufferSize = _bufferSize;
 	return stats;
 }
 
+AudioTelemetry* BaseSoundManager::GetTelemetry()
+{
+	return &_telemetry;
+}
+
 void BaseSoundManager::ResetStats()
 {
 	_cursorGapIndex = 0;
 	_cursorGapFilled = false;
 	_bufferUnderrunEventCount = 0;
+	_bufferOverrunEventCount = 0;
 	_averageLatency = 0;
 }
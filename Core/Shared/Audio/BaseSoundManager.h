@@ -1,11 +1,14 @@
 #pragma once
 #include "Core/Shared/Interfaces/IAudioDevice.h"
+#include "Core/Shared/Audio/AudioTelemetry.h"
 
 class BaseSoundManager : public IAudioDevice
 {
 public:
 	void ProcessLatency(uint32_t readPosition, uint32_t writePosition);
+	void ProcessLatency(uint32_t bufferedBytes);
 	AudioStatistics GetStatistics();
+	AudioTelemetry* GetTelemetry() override;
 
 protected:
 	bool _isStereo;
@@ -14,10 +17,13 @@ protected:
 	double _averageLatency = 0;
 	uint32_t _bufferSize = 0x10000;
 	uint32_t _bufferUnderrunEventCount = 0;
+	uint32_t _bufferOverrunEventCount = 0;
 
 	int32_t _cursorGaps[60];
 	int32_t _cursorGapIndex = 0;
 	bool _cursorGapFilled = false;
 
+	AudioTelemetry _telemetry;
+
 	void ResetStats();
 };
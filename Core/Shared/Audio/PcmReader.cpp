@@ -8,6 +8,7 @@ PcmReader::PcmReader()
 	_done = true;
 	_loopOffset = 8;
 	_outputBuffer = new int16_t[20000];
+	_file.EnableReadAhead(PcmReader::ReadAheadSize);
 }
 
 PcmReader::~PcmReader()
@@ -17,32 +18,23 @@ PcmReader::~PcmReader()
 
 bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 {
-	if(_file) {
-		_file.close();
-	}
-
-	_file.open(filename, ios::binary);
-	if(_file) {
-		_file.seekg(0, ios::end);
-		_fileSize = (uint32_t)_file.tellg();
+	if(_file.Open(filename)) {
+		_fileSize = (uint32_t)_file.GetSize();
 		if(_fileSize < 12) {
+			_file.Close();
+			_done = true;
 			return false;
 		}
 
-		_file.seekg(4, ios::beg);
-		uint32_t loopOffset = (uint8_t)_file.get();
-		loopOffset |= ((uint8_t)_file.get()) << 8;
-		loopOffset |= ((uint8_t)_file.get()) << 16;
-		loopOffset |= ((uint8_t)_file.get()) << 24;
-
-		_loopOffset = (uint32_t)loopOffset;
+		const uint8_t* data = _file.GetData();
+		_loopOffset = data[4] | (data[5] << 8) | (data[6] << 16) | (data[7] << 24);
 
 		_prevLeft = 0;
 		_prevRight = 0;
 		_done = false;
 		_loop = loop;
 		_fileOffset = startOffset;
-		_file.seekg(_fileOffset, ios::beg);
+		_file.Seek(_fileOffset);
 
 		_leftoverSampleCount = 0;
 		_pcmBuffer.clear();
@@ -76,12 +68,14 @@ void PcmReader::SetLoopFlag(bool loop)
 
 void PcmReader::ReadSample(int16_t &left, int16_t &right)
 {
-	uint8_t val[4];
-	_file.get(((char*)val)[0]);
-	_file.get(((char*)val)[1]);
-	_file.get(((char*)val)[2]);
-	_file.get(((char*)val)[3]);
+	if(_fileOffset + 4 > _fileSize) {
+		//Truncated sample at the end of the file
+		left = 0;
+		right = 0;
+		return;
+	}
 
+	const uint8_t* val = _file.GetData() + _fileOffset;
 	left = val[0] | (val[1] << 8);
 	right = val[2] | (val[3] << 8);
 }
@@ -108,12 +102,14 @@ void PcmReader::LoadSamples(uint32_t samplesToLoad)
 			if(_loop) {
 				i = _loopOffset * 4 + 8;
 				_fileOffset = i;
-				_file.seekg(_fileOffset, ios::beg);
+				_file.Seek(_fileOffset);
 			} else {
 				_done = true;
 			}
 		}
 	}
+
+	_file.UpdateReadPosition(_fileOffset);
 }
 
 void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume)
@@ -140,4 +136,9 @@ void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume
 uint32_t PcmReader::GetOffset()
 {
 	return _fileOffset;
+}
+
+MappedFileSeekStats PcmReader::TakeSeekStats()
+{
+	return _file.TakeSeekStats();
 }
\ No newline at end of file
@@ -2,16 +2,18 @@
 #include "pch.h"
 #include "Utilities/Audio/stb_vorbis.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/MemoryMappedFile.h"
 
 class PcmReader
 {
 private:
 	static constexpr int PcmSampleRate = 44100;
 	static constexpr int SamplesToRead = 100;
+	static constexpr int ReadAheadSize = 0x100000; //~6 seconds of audio
 
 	int16_t* _outputBuffer = nullptr;
 
-	ifstream _file;
+	MemoryMappedFile _file;
 	uint32_t _fileOffset = 0;
 	uint32_t _fileSize = 0;
 	uint32_t _loopOffset = 0;
@@ -41,4 +43,5 @@ public:
 	void SetLoopFlag(bool loop);
 	void ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume);
 	uint32_t GetOffset();
+	MappedFileSeekStats TakeSeekStats();
 };
@@ -18,6 +18,7 @@ SoundMixer::SoundMixer(Emulator* emu)
 	_audioDevice = nullptr;
 	_resampler.reset(new SoundResampler(emu));
 	_sampleBuffer = new int16_t[0x10000];
+	_floatBuffer = new float[0x10000];
 	_reverbFilter.reset(new ReverbFilter());
 	_crossFeedFilter.reset(new CrossFeedFilter());
 }
@@ -25,6 +26,7 @@ SoundMixer::SoundMixer(Emulator* emu)
 SoundMixer::~SoundMixer()
 {
 	delete[] _sampleBuffer;
+	delete[] _floatBuffer;
 }
 
 void SoundMixer::RegisterAudioDevice(IAudioDevice *audioDevice)
@@ -52,6 +54,14 @@ AudioStatistics SoundMixer::GetStatistics()
 	}
 }
 
+AudioTelemetry* SoundMixer::GetTelemetry()
+{
+	if(_audioDevice) {
+		return _audioDevice->GetTelemetry();
+	}
+	return nullptr;
+}
+
 void SoundMixer::StopAudio(bool clearBuffer)
 {
 	if(_audioDevice) {
@@ -74,6 +84,26 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	AudioConfig cfg = settings->GetAudioConfig();
 	bool isRecording = _waveRecorder || _emu->GetVideoRenderer()->IsRecording();
 
+	//Skip synthesis when nothing can hear the output (e.g headless runs), when requested for the run (e.g test runner),
+	//or when fast forwarding at 300%+ if the option is enabled. Recording and rewinding (which plays back the audio
+	//produced while rewinding) always need the samples.
+	bool wasSkipping = _skipSynthesis;
+	if(isRecording || _emu->GetRewindManager()->IsRewinding()) {
+		_skipSynthesis = false;
+	} else {
+		uint32_t emulationSpeed = settings->GetEmulationSpeed();
+		bool fastForwarding = emulationSpeed == 0 || emulationSpeed >= 300;
+		_skipSynthesis = (
+			!_audioDevice || !cfg.EnableAudio ||
+			settings->CheckFlag(EmulationFlags::SkipAudioSynthesis) ||
+			(cfg.SkipSynthesisInFastForward && fastForwarding)
+		);
+	}
+	if(_skipSynthesis && !wasSkipping && _audioDevice) {
+		//No more samples will be sent to the device, stop it to avoid looping the last buffer
+		_audioDevice->Stop();
+	}
+
 	uint32_t masterVolume = audioPlayer ? audioPlayer->GetVolume() : cfg.MasterVolume;
 	if(!isRecording) {
 		if(!audioPlayer && settings->CheckFlag(EmulationFlags::InBackground)) {
@@ -90,8 +120,8 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	_leftSample = samples[0];
 	_rightSample = samples[1];
 
+	//The resampler writes every sample up to "count", and providers mix on top of those, so the buffer doesn't need to be cleared
 	int16_t *out = _sampleBuffer;
-	memset(_sampleBuffer, 0, 0x10000 * 2);
 	uint32_t count = _resampler->Resample(samples, sampleCount, sourceRate, cfg.SampleRate, out);
 
 	uint32_t targetRate = (uint32_t)(cfg.SampleRate * _resampler->GetRateAdjustment());
@@ -99,31 +129,41 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		provider->MixAudio(out, count, targetRate);
 	}
 
+	if(_skipSynthesis) {
+		//Providers are still called above to keep their playback position in sync (e.g MSU-1, Super Game Boy)
+		return;
+	}
+
+	//Post-processing is done in a single float pass over the produced samples, and converted back to int16 once at the end
+	float* floatOut = _floatBuffer;
+	for(uint32_t i = 0; i < count * 2; i++) {
+		floatOut[i] = out[i];
+	}
+
 	if(cfg.EnableEqualizer) {
-		ProcessEqualizer(out, count, targetRate);
+		ProcessEqualizer(floatOut, count, targetRate);
 	}
 
 	if(audioPlayer) {
-		audioPlayer->ProcessSamples(out, count, targetRate);
+		audioPlayer->ProcessSamples(floatOut, count, targetRate);
 	}
 
 	if(cfg.ReverbEnabled) {
 		if(cfg.ReverbStrength > 0) {
-			_reverbFilter->ApplyFilter(out, count, cfg.SampleRate, cfg.ReverbStrength / 10.0, cfg.ReverbDelay / 10.0);
+			_reverbFilter->ApplyFilter(floatOut, count, cfg.SampleRate, cfg.ReverbStrength / 10.0, cfg.ReverbDelay / 10.0);
 		} else {
 			_reverbFilter->ResetFilter();
 		}
 	}
 
 	if(cfg.CrossFeedEnabled) {
-		_crossFeedFilter->ApplyFilter(out, count, cfg.CrossFeedRatio);
+		_crossFeedFilter->ApplyFilter(floatOut, count, cfg.CrossFeedRatio);
 	}
 
-	if(masterVolume < 100) {
-		//Apply volume if not using the default value
-		for(uint32_t i = 0; i < count * 2; i++) {
-			out[i] = (int32_t)out[i] * (int32_t)masterVolume / 100;
-		}
+	//Apply volume (if not using the default value) and convert back to int16
+	float volume = masterVolume < 100 ? masterVolume / 100.0f : 1.0f;
+	for(uint32_t i = 0; i < count * 2; i++) {
+		out[i] = (int16_t)std::clamp(floatOut[i] * volume, -32768.0f, 32767.0f);
 	}
 
 	RewindManager* rewindManager = _emu->GetRewindManager();
@@ -151,7 +191,7 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	}
 }
 
-void SoundMixer::ProcessEqualizer(int16_t* samples, uint32_t sampleCount, uint32_t targetRate)
+void SoundMixer::ProcessEqualizer(float* samples, uint32_t sampleCount, uint32_t targetRate)
 {
 	AudioConfig cfg = _emu->GetSettings()->GetAudioConfig();
 	if(!_equalizer) {
@@ -10,6 +10,7 @@ class WaveRecorder;
 class IAudioProvider;
 class CrossFeedFilter;
 class ReverbFilter;
+class AudioTelemetry;
 
 class SoundMixer 
 {
@@ -21,14 +22,17 @@ private:
 	unique_ptr<SoundResampler> _resampler;
 	safe_ptr<WaveRecorder> _waveRecorder;
 	int16_t *_sampleBuffer = nullptr;
+	float *_floatBuffer = nullptr;
 
 	int16_t _leftSample = 0;
 	int16_t _rightSample = 0;
 
+	bool _skipSynthesis = false;
+
 	unique_ptr<CrossFeedFilter> _crossFeedFilter;
 	unique_ptr<ReverbFilter> _reverbFilter;
 
-	void ProcessEqualizer(int16_t *samples, uint32_t sampleCount, uint32_t targetRate);
+	void ProcessEqualizer(float *samples, uint32_t sampleCount, uint32_t targetRate);
 
 public:
 	SoundMixer(Emulator *emu);
@@ -42,8 +46,13 @@ public:
 	void RegisterAudioProvider(IAudioProvider* provider);
 	void UnregisterAudioProvider(IAudioProvider* provider);
 
+	//When true, consoles only need to keep their audio state (registers, counters, etc.) up to date
+	//and can skip generating the actual samples - updated once per audio frame
+	bool IsSynthesisSkipped() { return _skipSynthesis; }
+
 	AudioStatistics GetStatistics();
 	double GetRateAdjustment();
+	AudioTelemetry* GetTelemetry();
 
 	void StartRecording(string filepath);
 	void StopRecording();
@@ -3,8 +3,10 @@
 #include "Shared/EmuSettings.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Shared/Audio/SoundResampler.h"
+#include "Shared/Audio/AudioTelemetry.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
 
 SoundResampler::SoundResampler(Emulator* emu)
 {
@@ -91,11 +93,38 @@ void SoundResampler::UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sample
 		_previousTargetRate = targetRate;
 		_prevInputRate = inputRate;
 		_resampler.SetSampleRates(inputRate, targetRate);
+		_sincResampler.SetSampleRates(inputRate, targetRate);
+	}
+}
+
+void SoundResampler::UpdateResamplerType(AudioResamplerType type)
+{
+	if(_resamplerType != type) {
+		_resamplerType = type;
+		_resampler.Reset();
+		_sincResampler.Reset();
+	}
+
+	switch(type) {
+		default: break;
+		case AudioResamplerType::SincLow: _sincResampler.SetQuality(SincResamplerQuality::Low); break;
+		case AudioResamplerType::SincMedium: _sincResampler.SetQuality(SincResamplerQuality::Medium); break;
+		case AudioResamplerType::SincHigh: _sincResampler.SetQuality(SincResamplerQuality::High); break;
 	}
 }
 
 uint32_t SoundResampler::Resample(int16_t *inSamples, uint32_t sampleCount, uint32_t sourceRate, uint32_t sampleRate, int16_t *outSamples)
 {
+	UpdateResamplerType(_emu->GetSettings()->GetAudioConfig().Resampler);
 	UpdateTargetSampleRate(sourceRate, sampleRate);
-	return _resampler.Resample<false>(inSamples, sampleCount, outSamples, 0);
+
+	if(AudioTelemetry* telemetry = _emu->GetSoundMixer()->GetTelemetry()) {
+		telemetry->RecordRateAdjustment(_rateAdjustment);
+	}
+
+	if(_resamplerType == AudioResamplerType::Hermite) {
+		return _resampler.Resample<false>(inSamples, sampleCount, outSamples, 0);
+	} else {
+		return _sincResampler.Resample(inSamples, sampleCount, outSamples);
+	}
 }
\ No newline at end of file
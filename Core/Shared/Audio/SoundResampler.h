@@ -1,6 +1,8 @@
 #pragma once
 #include "pch.h"
+#include "Shared/SettingTypes.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
 
 class Emulator;
 
@@ -15,9 +17,12 @@ private:
 	int32_t _underTarget = 0;
 
 	HermiteResampler _resampler;
+	SincResampler _sincResampler;
+	AudioResamplerType _resamplerType = AudioResamplerType::Hermite;
 
 	double GetTargetRateAdjustment();
 	void UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sampleRate);
+	void UpdateResamplerType(AudioResamplerType type);
 
 public:
 	SoundResampler(Emulator *emu);
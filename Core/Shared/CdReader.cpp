@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Shared/CdReader.h"
+#include "Shared/ChdReader.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/FolderUtilities.h"
@@ -227,6 +228,67 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
 	disc.DiscSize = discLastTrk.FileOffset + discLastTrk.Size;
 	disc.DiscSectorCount = discLastTrk.LastSector + 1;
 
+	LogDiscInfo(disc);
+	return disc.Tracks.size() > 0;
+}
+
+bool CdReader::LoadChd(VirtualFile& file, DiscInfo& disc)
+{
+	shared_ptr<ChdReader> chd(new ChdReader());
+	if(!chd->Open(file)) {
+		return false;
+	}
+
+	disc.Chd = chd;
+	disc.Files.push_back(file);
+	disc.DiscSize = 0;
+
+	uint32_t lba = 0;
+	for(ChdTrackInfo& chdTrk : chd->GetTracks()) {
+		TrackInfo trk = {};
+		trk.Format = chdTrk.Format;
+
+		//Pregap sectors belong to no track, like INDEX 00/PREGAP entries in cue files
+		uint32_t pregapFrames = chdTrk.PregapInFile ? chdTrk.Pregap : 0;
+		if(chdTrk.FrameCount <= pregapFrames) {
+			MessageManager::Log("[CHD] Invalid track length");
+			return false;
+		}
+
+		if(chdTrk.Pregap > 0) {
+			trk.HasLeadIn = true;
+			trk.LeadInPosition = DiscPosition::FromLba(lba);
+		}
+
+		trk.FirstSector = lba + chdTrk.Pregap;
+		trk.StartPosition = DiscPosition::FromLba(trk.FirstSector);
+		trk.SectorCount = chdTrk.FrameCount - pregapFrames;
+		trk.LastSector = trk.FirstSector + trk.SectorCount - 1;
+		trk.EndPosition = DiscPosition::FromLba(trk.LastSector);
+		trk.Size = trk.SectorCount * trk.GetSectorSize();
+		trk.FileIndex = 0;
+		trk.FileOffset = chdTrk.FrameOffset + pregapFrames;
+		disc.Tracks.push_back(trk);
+
+		disc.DiscSize += trk.Size;
+		lba = trk.LastSector + 1 + chdTrk.Postgap;
+	}
+
+	TrackInfo& discLastTrk = disc.Tracks[disc.Tracks.size() - 1];
+	disc.EndPosition = discLastTrk.EndPosition;
+	disc.DiscSectorCount = discLastTrk.LastSector + 1;
+
+	LogDiscInfo(disc);
+	return true;
+}
+
+bool DiscInfo::ReadChdSector(uint32_t frame, uint8_t* out, uint32_t offset, uint32_t length)
+{
+	return Chd->ReadSector(frame, out, offset, length);
+}
+
+void CdReader::LogDiscInfo(DiscInfo& disc)
+{
 	MessageManager::Log("---- DISC TRACKS ----");
 	int i = 1;
 	for(TrackInfo& trk : disc.Tracks) {
@@ -240,6 +302,4 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc)
 		i++;
 	}
 	MessageManager::Log("---- END TRACKS ----");
-
-	return disc.Tracks.size() > 0;
 }
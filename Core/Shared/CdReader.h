@@ -3,6 +3,8 @@
 #include "Utilities/VirtualFile.h"
 #include "Shared/MessageManager.h"
 
+class ChdReader;
+
 enum class TrackFormat
 {
 	Audio,
@@ -84,6 +86,11 @@ struct DiscInfo
 	uint32_t DiscSectorCount;
 	DiscPosition EndPosition;
 
+	//Set for CHD images - TrackInfo::FileOffset is then the index of the track's first frame in the CHD file
+	shared_ptr<ChdReader> Chd;
+
+	bool ReadChdSector(uint32_t frame, uint8_t* out, uint32_t offset, uint32_t length);
+
 	int32_t GetTrack(uint32_t sector)
 	{
 		for(size_t i = 0; i < Tracks.size(); i++) {
@@ -124,6 +131,16 @@ struct DiscInfo
 			TrackInfo& trk = Tracks[track];
 			uint32_t sectorSize = trk.GetSectorSize();
 			uint32_t sectorHeaderSize = trk.Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
+			if(Chd) {
+				uint8_t data[2048];
+				if(ReadChdSector(trk.FileOffset + sector - trk.FirstSector, data, sectorHeaderSize, 2048)) {
+					outData.insert(outData.end(), data, data + 2048);
+				} else {
+					LogDebug("Invalid read offsets");
+				}
+				return;
+			}
+
 			uint32_t byteOffset = trk.FileOffset + (sector - trk.FirstSector) * sectorSize;
 			if(!Files[trk.FileIndex].ReadChunk(outData, byteOffset + sectorHeaderSize, 2048)) {
 				LogDebug("Invalid read offsets");
@@ -139,6 +156,12 @@ struct DiscInfo
 			return 0;
 		}
 
+		if(Chd) {
+			uint8_t data[2] = {};
+			ReadChdSector(Tracks[track].FileOffset + sector - Tracks[track].FirstSector, data, sample * 4 + byteOffset, 2);
+			return (int16_t)(data[0] | (data[1] << 8));
+		}
+
 		uint32_t fileIndex = Tracks[track].FileIndex;
 		uint32_t startByte = Tracks[track].FileOffset + (sector - Tracks[track].FirstSector) * DiscInfo::SectorSize;
 		return (int16_t)(Files[fileIndex].ReadByte(startByte + sample * 4 + byteOffset) | (Files[fileIndex].ReadByte(startByte + sample * 4 + 1 + byteOffset) << 8));
@@ -157,8 +180,12 @@ struct DiscInfo
 
 class CdReader
 {
+private:
+	static void LogDiscInfo(DiscInfo& disc);
+
 public:
 	static bool LoadCue(VirtualFile& file, DiscInfo& disc);
+	static bool LoadChd(VirtualFile& file, DiscInfo& disc);
 
 	static uint8_t ToBcd(uint8_t value)
 	{
@@ -0,0 +1,251 @@
+#include "pch.h"
+#include <chrono>
+#include "Shared/CdSectorCache.h"
+#include "Shared/CdReader.h"
+
+CdSectorCache::CdSectorCache(DiscInfo& disc)
+{
+	_disc = &disc;
+	for(VirtualFile& file : _disc->Files) {
+		FileInfo info;
+		info.Path = file.GetFilePath();
+		info.Size = file.GetSize();
+		info.IsArchive = file.IsArchive();
+		_files.push_back(info);
+	}
+	_emuFiles.resize(_files.size());
+	_ioFiles.resize(_files.size());
+	_blockCount = (_disc->DiscSectorCount + CdSectorCache::BlockSectorCount - 1) / CdSectorCache::BlockSectorCount;
+
+	for(uint32_t i = 0; i < CdSectorCache::StreamCount; i++) {
+		_streamPosition[i] = 0;
+		_currentBlockId[i] = UINT32_MAX;
+		_currentSector[i] = UINT32_MAX;
+	}
+
+	_stopIoThread = false;
+	_ioThread = std::thread(&CdSectorCache::IoThread, this);
+}
+
+CdSectorCache::~CdSectorCache()
+{
+	_stopIoThread = true;
+	_ioSignal.Signal();
+	_ioThread.join();
+}
+
+void CdSectorCache::Prefetch(uint32_t sector, CdReadStream stream)
+{
+	_streamPosition[(int)stream] = sector;
+	_ioSignal.Signal();
+}
+
+CdSectorCacheStats CdSectorCache::GetStats()
+{
+	auto lock = _lock.AcquireSafe();
+	return _stats;
+}
+
+bool CdSectorCache::LoadBlock(CacheBlock& block, uint32_t blockId, vector<unique_ptr<ifstream>>& files, bool allowArchives)
+{
+	for(uint32_t i = 0; i < CdSectorCache::BlockSectorCount; i++) {
+		uint32_t sector = blockId * CdSectorCache::BlockSectorCount + i;
+		int32_t track = _disc->GetTrack(sector);
+		if(track < 0) {
+			continue;
+		}
+
+		TrackInfo& trk = _disc->Tracks[track];
+		uint32_t sectorSize = trk.GetSectorSize();
+		uint8_t* dst = block.Data + i * CdSectorCache::SectorSize;
+		if(_disc->Chd) {
+			//CHD reads are thread-safe, the hunks are decompressed on the I/O thread
+			if(_disc->ReadChdSector(trk.FileOffset + sector - trk.FirstSector, dst, 0, sectorSize)) {
+				block.Length[i] = (uint16_t)sectorSize;
+			}
+			continue;
+		}
+
+		uint64_t byteOffset = trk.FileOffset + (uint64_t)(sector - trk.FirstSector) * sectorSize;
+		FileInfo& file = _files[trk.FileIndex];
+		if(byteOffset >= file.Size) {
+			continue;
+		}
+
+		uint32_t length = (uint32_t)std::min<uint64_t>(sectorSize, file.Size - byteOffset);
+		if(file.IsArchive) {
+			if(!allowArchives) {
+				//Only the emulation thread can read from archives (VirtualFile isn't thread-safe)
+				return false;
+			}
+			vector<uint8_t> data;
+			_disc->Files[trk.FileIndex].ReadChunk(data, (int)byteOffset, (int)length);
+			memcpy(dst, data.data(), std::min<size_t>(data.size(), length));
+		} else {
+			unique_ptr<ifstream>& stream = files[trk.FileIndex];
+			if(!stream) {
+				stream.reset(new ifstream(file.Path, std::ios::in | std::ios::binary));
+			}
+			stream->clear();
+			stream->seekg(byteOffset, std::ios::beg);
+			stream->read((char*)dst, length);
+		}
+		block.Length[i] = (uint16_t)length;
+	}
+	return true;
+}
+
+void CdSectorCache::InsertBlock(uint32_t blockId, shared_ptr<CacheBlock> block)
+{
+	//Caller must hold the lock
+	block->LastUse = ++_useCounter;
+	_blocks[blockId] = block;
+
+	if(_blocks.size() > CdSectorCache::MaxBlockCount) {
+		//Evict the least recently used block that isn't about to be needed
+		uint32_t windowStart[CdSectorCache::StreamCount];
+		for(uint32_t i = 0; i < CdSectorCache::StreamCount; i++) {
+			windowStart[i] = _streamPosition[i] / CdSectorCache::BlockSectorCount;
+		}
+
+		auto oldest = _blocks.end();
+		for(auto it = _blocks.begin(); it != _blocks.end(); it++) {
+			bool inWindow = false;
+			for(uint32_t i = 0; i < CdSectorCache::StreamCount; i++) {
+				if(it->first >= windowStart[i] && it->first < windowStart[i] + CdSectorCache::PrefetchBlockCount) {
+					inWindow = true;
+					break;
+				}
+			}
+			if(!inWindow && (oldest == _blocks.end() || it->second->LastUse < oldest->second->LastUse)) {
+				oldest = it;
+			}
+		}
+
+		if(oldest != _blocks.end()) {
+			_blocks.erase(oldest);
+		}
+	}
+}
+
+const uint8_t* CdSectorCache::GetSector(uint32_t sector, CdReadStream stream, uint16_t& length)
+{
+	int index = (int)stream;
+	uint32_t blockId = sector / CdSectorCache::BlockSectorCount;
+	uint32_t offset = sector % CdSectorCache::BlockSectorCount;
+
+	if(blockId != _currentBlockId[index]) {
+		_streamPosition[index] = sector;
+
+		shared_ptr<CacheBlock> block;
+		{
+			auto lock = _lock.AcquireSafe();
+			auto result = _blocks.find(blockId);
+			if(result != _blocks.end()) {
+				block = result->second;
+				block->LastUse = ++_useCounter;
+				_stats.HitCount++;
+			}
+		}
+
+		if(!block) {
+			//Not loaded yet, this has to wait for the disk
+			auto start = std::chrono::high_resolution_clock::now();
+			block.reset(new CacheBlock());
+			LoadBlock(*block, blockId, _emuFiles, true);
+			double stallUs = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+
+			auto lock = _lock.AcquireSafe();
+			_stats.MissCount++;
+			_stats.MaxStallUs = std::max(_stats.MaxStallUs, stallUs);
+			InsertBlock(blockId, block);
+		}
+
+		_currentBlock[index] = block;
+		_currentBlockId[index] = blockId;
+		_currentSector[index] = sector;
+
+		//Start loading the next blocks
+		_ioSignal.Signal();
+	} else if(sector != _currentSector[index]) {
+		_currentSector[index] = sector;
+		auto lock = _lock.AcquireSafe();
+		_stats.HitCount++;
+	}
+
+	length = _currentBlock[index]->Length[offset];
+	return _currentBlock[index]->Data + offset * CdSectorCache::SectorSize;
+}
+
+void CdSectorCache::ReadDataSector(uint32_t sector, deque<uint8_t>& outData)
+{
+	constexpr int Mode1_2352_SectorHeaderSize = 16;
+
+	int32_t track = _disc->GetTrack(sector);
+	if(track < 0) {
+		//TODO support reading pregap when it's available
+		LogDebug("Invalid sector/track (or inside pregap)");
+		outData.insert(outData.end(), 2048, 0);
+	} else {
+		uint32_t sectorHeaderSize = _disc->Tracks[track].Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
+		uint16_t length;
+		const uint8_t* data = GetSector(sector, CdReadStream::Data, length);
+		if(sectorHeaderSize + 2048 <= length) {
+			outData.insert(outData.end(), data + sectorHeaderSize, data + sectorHeaderSize + 2048);
+		} else {
+			LogDebug("Invalid read offsets");
+		}
+	}
+}
+
+int16_t CdSectorCache::ReadLeftSample(uint32_t sector, uint32_t sample)
+{
+	uint16_t length;
+	const uint8_t* data = GetSector(sector, CdReadStream::Audio, length) + sample * 4;
+	return (int16_t)(data[0] | (data[1] << 8));
+}
+
+int16_t CdSectorCache::ReadRightSample(uint32_t sector, uint32_t sample)
+{
+	uint16_t length;
+	const uint8_t* data = GetSector(sector, CdReadStream::Audio, length) + sample * 4;
+	return (int16_t)(data[2] | (data[3] << 8));
+}
+
+bool CdSectorCache::FindBlockToPrefetch(uint32_t& blockId)
+{
+	auto lock = _lock.AcquireSafe();
+	//Fill the start of each window first, so all streams get their next block quickly
+	for(uint32_t i = 0; i < CdSectorCache::PrefetchBlockCount; i++) {
+		for(uint32_t j = 0; j < CdSectorCache::StreamCount; j++) {
+			uint32_t id = _streamPosition[j] / CdSectorCache::BlockSectorCount + i;
+			if(id < _blockCount && _blocks.find(id) == _blocks.end()) {
+				blockId = id;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void CdSectorCache::IoThread()
+{
+	while(!_stopIoThread) {
+		_ioSignal.Wait();
+
+		uint32_t blockId;
+		while(!_stopIoThread && FindBlockToPrefetch(blockId)) {
+			shared_ptr<CacheBlock> block(new CacheBlock());
+			if(!LoadBlock(*block, blockId, _ioFiles, false)) {
+				//Archived file, the emulation thread will load it when needed
+				break;
+			}
+
+			auto lock = _lock.AcquireSafe();
+			if(_blocks.find(blockId) == _blocks.end()) {
+				InsertBlock(blockId, block);
+				_stats.PrefetchedBlockCount++;
+			}
+		}
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+
+struct DiscInfo;
+
+enum class CdReadStream
+{
+	Data = 0,
+	Audio = 1,
+	AudioLoop = 2
+};
+
+struct CdSectorCacheStats
+{
+	//Number of times a new sector was accessed, and whether it was already in memory
+	uint64_t HitCount = 0;
+	uint64_t MissCount = 0;
+	uint64_t PrefetchedBlockCount = 0;
+
+	//Longest time the emulation thread had to wait for a read from the disk
+	double MaxStallUs = 0;
+};
+
+//Keeps recently used and upcoming sectors in memory. An I/O thread reads ahead of the current
+//data/audio positions (and seek targets), so the emulation thread doesn't have to wait for the disk.
+class CdSectorCache
+{
+private:
+	static constexpr uint32_t BlockSectorCount = 16;
+	static constexpr uint32_t MaxBlockCount = 256; //~9.6MB
+	static constexpr uint32_t PrefetchBlockCount = 8; //128 sectors, ~1.7 seconds of CD audio
+	static constexpr uint32_t StreamCount = 3;
+	static constexpr uint32_t SectorSize = 2352;
+
+	struct CacheBlock
+	{
+		uint8_t Data[BlockSectorCount * SectorSize] = {};
+		uint16_t Length[BlockSectorCount] = {};
+		uint64_t LastUse = 0;
+	};
+
+	struct FileInfo
+	{
+		string Path;
+		uint64_t Size = 0;
+		bool IsArchive = false;
+	};
+
+	DiscInfo* _disc = nullptr;
+	vector<FileInfo> _files;
+	uint32_t _blockCount = 0;
+
+	//Only used by the emulation thread
+	shared_ptr<CacheBlock> _currentBlock[StreamCount];
+	uint32_t _currentBlockId[StreamCount] = {};
+	uint32_t _currentSector[StreamCount] = {};
+	vector<unique_ptr<ifstream>> _emuFiles;
+
+	//_lock protects _blocks, _useCounter and _stats
+	SimpleLock _lock;
+	unordered_map<uint32_t, shared_ptr<CacheBlock>> _blocks;
+	uint64_t _useCounter = 0;
+	CdSectorCacheStats _stats = {};
+
+	std::thread _ioThread;
+	AutoResetEvent _ioSignal;
+	atomic<bool> _stopIoThread;
+	atomic<uint32_t> _streamPosition[StreamCount];
+	vector<unique_ptr<ifstream>> _ioFiles;
+
+	void IoThread();
+	bool FindBlockToPrefetch(uint32_t& blockId);
+	bool LoadBlock(CacheBlock& block, uint32_t blockId, vector<unique_ptr<ifstream>>& files, bool allowArchives);
+	void InsertBlock(uint32_t blockId, shared_ptr<CacheBlock> block);
+	const uint8_t* GetSector(uint32_t sector, CdReadStream stream, uint16_t& length);
+
+public:
+	CdSectorCache(DiscInfo& disc);
+	~CdSectorCache();
+
+	//Lets the I/O thread start loading sectors at the target of a seek, before they are needed
+	void Prefetch(uint32_t sector, CdReadStream stream);
+
+	void ReadDataSector(uint32_t sector, deque<uint8_t>& outData);
+	int16_t ReadLeftSample(uint32_t sector, uint32_t sample);
+	int16_t ReadRightSample(uint32_t sector, uint32_t sample);
+
+	CdSectorCacheStats GetStats();
+};
@@ -0,0 +1,635 @@
+#include "pch.h"
+#include "Shared/ChdReader.h"
+#include "Shared/MessageManager.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/Audio/FlacDecoder.h"
+#include "Utilities/miniz.h"
+#include "SevenZip/7zAlloc.h"
+#include "SevenZip/LzmaDec.h"
+
+static constexpr uint32_t MakeChdTag(char a, char b, char c, char d)
+{
+	return ((uint32_t)a << 24) | ((uint32_t)b << 16) | ((uint32_t)c << 8) | (uint32_t)d;
+}
+
+static constexpr uint32_t CdZlibCodec = MakeChdTag('c', 'd', 'z', 'l');
+static constexpr uint32_t CdLzmaCodec = MakeChdTag('c', 'd', 'l', 'z');
+static constexpr uint32_t CdFlacCodec = MakeChdTag('c', 'd', 'f', 'l');
+static constexpr uint32_t TrackMetadataTag = MakeChdTag('C', 'H', 'T', 'R');
+static constexpr uint32_t TrackMetadata2Tag = MakeChdTag('C', 'H', 'T', '2');
+
+static constexpr uint8_t CdSyncHeader[12] = { 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+
+//MSB-first bit reader, used to decode the compressed hunk map
+struct ChdBitReader
+{
+	const uint8_t* Data;
+	size_t Size;
+	size_t BitPos = 0;
+
+	uint64_t Read(uint32_t count)
+	{
+		uint64_t value = 0;
+		for(uint32_t i = 0; i < count; i++) {
+			size_t byte = BitPos >> 3;
+			uint32_t bit = byte < Size ? (Data[byte] >> (7 - (BitPos & 0x07))) & 0x01 : 0;
+			value = (value << 1) | bit;
+			BitPos++;
+		}
+		return value;
+	}
+
+	bool IsOverflow()
+	{
+		return BitPos > Size * 8;
+	}
+};
+
+//Canonical huffman decoder for the hunk compression types (16 codes, up to 8 bits each)
+struct ChdHuffmanDecoder
+{
+	static constexpr uint32_t CodeCount = 16;
+	static constexpr uint32_t MaxBits = 8;
+
+	uint8_t CodeBits[CodeCount] = {};
+	uint16_t Lookup[1 << MaxBits] = {};
+
+	bool ImportTree(ChdBitReader& reader)
+	{
+		//The code lengths are RLE-encoded, with 4 bits per value
+		uint32_t code = 0;
+		while(code < CodeCount) {
+			uint32_t bits = (uint32_t)reader.Read(4);
+			if(bits != 1) {
+				CodeBits[code++] = bits;
+			} else {
+				bits = (uint32_t)reader.Read(4);
+				if(bits == 1) {
+					CodeBits[code++] = 1;
+				} else {
+					uint32_t repeatCount = (uint32_t)reader.Read(4) + 3;
+					while(repeatCount--) {
+						if(code >= CodeCount) {
+							return false;
+						}
+						CodeBits[code++] = bits;
+					}
+				}
+			}
+		}
+
+		uint32_t startCodes[33] = {};
+		for(uint32_t i = 0; i < CodeCount; i++) {
+			if(CodeBits[i] > MaxBits) {
+				return false;
+			}
+			startCodes[CodeBits[i]]++;
+		}
+
+		uint32_t start = 0;
+		for(int length = 32; length > 0; length--) {
+			uint32_t next = (start + startCodes[length]) >> 1;
+			if(length != 1 && next * 2 != start + startCodes[length]) {
+				return false;
+			}
+			startCodes[length] = start;
+			start = next;
+		}
+
+		for(uint32_t i = 0; i < CodeCount; i++) {
+			if(CodeBits[i] > 0) {
+				uint32_t value = startCodes[CodeBits[i]]++;
+				uint32_t shift = MaxBits - CodeBits[i];
+				for(uint32_t j = value << shift; j < ((value + 1) << shift) && j < (1 << MaxBits); j++) {
+					Lookup[j] = (uint16_t)((i << 5) | CodeBits[i]);
+				}
+			}
+		}
+
+		return !reader.IsOverflow();
+	}
+
+	uint8_t Decode(ChdBitReader& reader)
+	{
+		size_t pos = reader.BitPos;
+		uint16_t entry = Lookup[reader.Read(MaxBits)];
+		reader.BitPos = pos + (entry & 0x1F);
+		return (uint8_t)(entry >> 5);
+	}
+};
+
+static uint16_t GetChdCrc16(const uint8_t* data, size_t size)
+{
+	uint16_t crc = 0xFFFF;
+	for(size_t i = 0; i < size; i++) {
+		crc ^= data[i] << 8;
+		for(int j = 0; j < 8; j++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+		}
+	}
+	return crc;
+}
+
+bool ChdReader::Open(VirtualFile& file)
+{
+	_file = file;
+	_data = _file.GetData();
+	_size = _file.GetSize();
+
+	if(!ReadHeader() || !ReadMap() || !ReadMetadata()) {
+		return false;
+	}
+
+	InitLzmaProps();
+	return true;
+}
+
+uint64_t ChdReader::ReadBigEndian(uint64_t offset, uint32_t byteCount)
+{
+	uint64_t value = 0;
+	if(offset <= _size && byteCount <= _size - offset) {
+		for(uint32_t i = 0; i < byteCount; i++) {
+			value = (value << 8) | _data[offset + i];
+		}
+	}
+	return value;
+}
+
+bool ChdReader::ReadHeader()
+{
+	constexpr uint32_t HeaderSize = 124;
+	if(_size < HeaderSize || memcmp(_data, "MComprHD", 8) != 0) {
+		MessageManager::Log("[CHD] Invalid CHD file");
+		return false;
+	}
+
+	uint32_t version = (uint32_t)ReadBigEndian(12, 4);
+	if(version != 5) {
+		MessageManager::Log("[CHD] Unsupported CHD version: " + std::to_string(version));
+		return false;
+	}
+
+	for(int i = 0; i < 4; i++) {
+		_codecs[i] = (uint32_t)ReadBigEndian(16 + i * 4, 4);
+		if(_codecs[i] != 0 && _codecs[i] != CdZlibCodec && _codecs[i] != CdLzmaCodec && _codecs[i] != CdFlacCodec) {
+			string name = { (char)(_codecs[i] >> 24), (char)(_codecs[i] >> 16), (char)(_codecs[i] >> 8), (char)_codecs[i] };
+			MessageManager::Log("[CHD] Unsupported compression format: " + name);
+			return false;
+		}
+	}
+
+	uint64_t logicalBytes = ReadBigEndian(32, 8);
+	_mapOffset = ReadBigEndian(40, 8);
+	_metaOffset = ReadBigEndian(48, 8);
+	_hunkBytes = (uint32_t)ReadBigEndian(56, 4);
+	_unitBytes = (uint32_t)ReadBigEndian(60, 4);
+
+	for(int i = 0; i < 20; i++) {
+		if(_data[104 + i] != 0) {
+			MessageManager::Log("[CHD] CHD files that depend on a parent CHD file are not supported");
+			return false;
+		}
+	}
+
+	if(_hunkBytes == 0 || _hunkBytes % ChdReader::FrameSize != 0 || _unitBytes != ChdReader::FrameSize) {
+		MessageManager::Log("[CHD] File is not a CD image");
+		return false;
+	}
+
+	//The hunk count determines the size of the map allocations, reject anything larger than a CD
+	if(logicalBytes == 0 || logicalBytes > (uint64_t)ChdReader::MaxFrameCount * ChdReader::FrameSize) {
+		MessageManager::Log("[CHD] Invalid CD image size");
+		return false;
+	}
+
+	_hunkCount = (uint32_t)((logicalBytes + _hunkBytes - 1) / _hunkBytes);
+	_framesPerHunk = _hunkBytes / ChdReader::FrameSize;
+	return true;
+}
+
+bool ChdReader::ReadMap()
+{
+	if(_codecs[0] != 0) {
+		return ReadCompressedMap();
+	}
+
+	//Uncompressed file, each map entry is the hunk's position in the file (in hunks)
+	if(_mapOffset > _size || (uint64_t)_hunkCount * 4 > _size - _mapOffset) {
+		MessageManager::Log("[CHD] Invalid hunk map");
+		return false;
+	}
+
+	_map.resize(_hunkCount);
+	for(uint32_t i = 0; i < _hunkCount; i++) {
+		uint64_t offset = ReadBigEndian(_mapOffset + (uint64_t)i * 4, 4) * _hunkBytes;
+		_map[i] = { offset ? HunkType::Uncompressed : HunkType::Zero, _hunkBytes, offset };
+	}
+	return true;
+}
+
+bool ChdReader::ReadCompressedMap()
+{
+	//Extra values used in the compressed map, on top of the HunkType values
+	constexpr uint8_t RleSmall = 7;
+	constexpr uint8_t RleLarge = 8;
+	constexpr uint8_t Self0 = 9;
+	constexpr uint8_t Self1 = 10;
+	constexpr uint8_t ParentSelf = 11;
+	constexpr uint8_t Parent0 = 12;
+	constexpr uint8_t Parent1 = 13;
+
+	if(_mapOffset > _size || _size - _mapOffset < 16) {
+		MessageManager::Log("[CHD] Invalid hunk map");
+		return false;
+	}
+
+	uint32_t mapBytes = (uint32_t)ReadBigEndian(_mapOffset, 4);
+	uint64_t firstOffset = ReadBigEndian(_mapOffset + 4, 6);
+	uint16_t mapCrc = (uint16_t)ReadBigEndian(_mapOffset + 10, 2);
+	uint32_t lengthBits = (uint32_t)ReadBigEndian(_mapOffset + 12, 1);
+	uint32_t selfBits = (uint32_t)ReadBigEndian(_mapOffset + 13, 1);
+	uint32_t parentBits = (uint32_t)ReadBigEndian(_mapOffset + 14, 1);
+	if(mapBytes > _size - _mapOffset - 16) {
+		MessageManager::Log("[CHD] Invalid hunk map");
+		return false;
+	}
+
+	ChdBitReader reader = { _data + _mapOffset + 16, mapBytes };
+	ChdHuffmanDecoder decoder;
+	if(!decoder.ImportTree(reader)) {
+		MessageManager::Log("[CHD] Invalid hunk map");
+		return false;
+	}
+
+	//Compression type for each hunk
+	vector<uint8_t> types(_hunkCount);
+	uint8_t lastType = 0;
+	uint32_t repeatCount = 0;
+	for(uint32_t i = 0; i < _hunkCount; i++) {
+		if(repeatCount > 0) {
+			types[i] = lastType;
+			repeatCount--;
+		} else {
+			uint8_t type = decoder.Decode(reader);
+			if(type == RleSmall) {
+				types[i] = lastType;
+				repeatCount = 2 + decoder.Decode(reader);
+			} else if(type == RleLarge) {
+				types[i] = lastType;
+				repeatCount = 2 + 16 + (decoder.Decode(reader) << 4);
+				repeatCount += decoder.Decode(reader);
+			} else {
+				types[i] = lastType = type;
+			}
+		}
+	}
+
+	if(reader.IsOverflow()) {
+		//The header's hunk count doesn't match the map
+		MessageManager::Log("[CHD] Invalid hunk map");
+		return false;
+	}
+
+	//Position and length of each hunk - the CRC is calculated on the decoded map (12 bytes per hunk)
+	vector<uint8_t> rawMap((size_t)_hunkCount * 12);
+	_map.resize(_hunkCount);
+	uint64_t currentOffset = firstOffset;
+	uint64_t lastSelf = 0;
+	uint64_t lastParent = 0;
+	for(uint32_t i = 0; i < _hunkCount; i++) {
+		uint8_t type = types[i];
+		uint64_t offset = currentOffset;
+		uint32_t length = 0;
+		uint16_t crc = 0;
+		switch(type) {
+			case (uint8_t)HunkType::Codec0:
+			case (uint8_t)HunkType::Codec1:
+			case (uint8_t)HunkType::Codec2:
+			case (uint8_t)HunkType::Codec3:
+				length = (uint32_t)reader.Read(lengthBits);
+				currentOffset += length;
+				crc = (uint16_t)reader.Read(16);
+				break;
+
+			case (uint8_t)HunkType::Uncompressed:
+				length = _hunkBytes;
+				currentOffset += length;
+				crc = (uint16_t)reader.Read(16);
+				break;
+
+			case (uint8_t)HunkType::Self: lastSelf = offset = reader.Read(selfBits); break;
+			case (uint8_t)HunkType::Parent: lastParent = offset = reader.Read(parentBits); break;
+
+			case Self1: lastSelf++; [[fallthrough]];
+			case Self0: type = (uint8_t)HunkType::Self; offset = lastSelf; break;
+
+			case ParentSelf: type = (uint8_t)HunkType::Parent; lastParent = offset = (uint64_t)i * _hunkBytes / _unitBytes; break;
+			case Parent1: lastParent += _hunkBytes / _unitBytes; [[fallthrough]];
+			case Parent0: type = (uint8_t)HunkType::Parent; offset = lastParent; break;
+
+			default:
+				MessageManager::Log("[CHD] Invalid hunk map");
+				return false;
+		}
+
+		uint8_t* entry = &rawMap[(size_t)i * 12];
+		entry[0] = type;
+		for(int j = 0; j < 3; j++) {
+			entry[1 + j] = (uint8_t)(length >> ((2 - j) * 8));
+		}
+		for(int j = 0; j < 6; j++) {
+			entry[4 + j] = (uint8_t)(offset >> ((5 - j) * 8));
+		}
+		entry[10] = crc >> 8;
+		entry[11] = (uint8_t)crc;
+
+		_map[i] = { (HunkType)type, length, offset };
+	}
+
+	if(reader.IsOverflow() || GetChdCrc16(rawMap.data(), rawMap.size()) != mapCrc) {
+		MessageManager::Log("[CHD] Invalid hunk map");
+		return false;
+	}
+	return true;
+}
+
+bool ChdReader::ReadMetadata()
+{
+	vector<ChdTrackInfo> tracks;
+	uint64_t offset = _metaOffset;
+	for(int i = 0; offset != 0 && offset <= _size && _size - offset >= 16 && i < 1000; i++) {
+		uint32_t tag = (uint32_t)ReadBigEndian(offset, 4);
+		uint32_t length = (uint32_t)ReadBigEndian(offset + 4, 4) & 0xFFFFFF;
+		uint64_t next = ReadBigEndian(offset + 8, 8);
+
+		if((tag == TrackMetadataTag || tag == TrackMetadata2Tag) && length <= _size - offset - 16) {
+			//e.g: "TRACK:1 TYPE:MODE1_RAW SUBTYPE:NONE FRAMES:1234 PREGAP:150 PGTYPE:VMODE1_RAW PGSUB:NONE POSTGAP:0"
+			string text = string((char*)_data + offset + 16, length).c_str();
+			ChdTrackInfo trk = {};
+			string type;
+			string pregapType;
+			for(string& field : StringUtilities::Split(text, ' ')) {
+				size_t separator = field.find(':');
+				if(separator == string::npos) {
+					continue;
+				}
+
+				string key = field.substr(0, separator);
+				string value = field.substr(separator + 1);
+				try {
+					if(key == "TRACK") {
+						trk.Number = std::stoi(value);
+					} else if(key == "TYPE") {
+						type = value;
+					} else if(key == "FRAMES") {
+						trk.FrameCount = std::stoi(value);
+					} else if(key == "PREGAP") {
+						trk.Pregap = std::stoi(value);
+					} else if(key == "PGTYPE") {
+						pregapType = value;
+					} else if(key == "POSTGAP") {
+						trk.Postgap = std::stoi(value);
+					}
+				} catch(const std::exception&) {
+					MessageManager::Log("[CHD] Invalid track information: " + text);
+					return false;
+				}
+			}
+
+			if(type == "AUDIO") {
+				trk.Format = TrackFormat::Audio;
+			} else if(type == "MODE1_RAW") {
+				trk.Format = TrackFormat::Mode1_2352;
+			} else if(type == "MODE1") {
+				trk.Format = TrackFormat::Mode1_2048;
+			} else {
+				MessageManager::Log("[CHD] Unsupported track format: " + type);
+				return false;
+			}
+
+			//Pregap data is only stored in the file when its type starts with "V"
+			trk.PregapInFile = pregapType.size() > 0 && pregapType[0] == 'V';
+			tracks.push_back(trk);
+		}
+
+		offset = next;
+	}
+
+	if(tracks.empty()) {
+		MessageManager::Log("[CHD] No CD track information found");
+		return false;
+	}
+
+	std::sort(tracks.begin(), tracks.end(), [](const ChdTrackInfo& a, const ChdTrackInfo& b) { return a.Number < b.Number; });
+
+	//Each track is padded to a multiple of 4 frames
+	uint32_t frameOffset = 0;
+	for(ChdTrackInfo& trk : tracks) {
+		trk.FrameOffset = frameOffset;
+		frameOffset += (trk.FrameCount + 3) & ~0x03;
+	}
+
+	_tracks = tracks;
+	return true;
+}
+
+void ChdReader::InitLzmaProps()
+{
+	//The LZMA properties aren't stored in the file, they match what the compressor uses (level 9, with the dictionary reduced to fit the hunk size)
+	uint32_t dictSize = 1 << 26;
+	for(uint32_t i = 11; i <= 30; i++) {
+		if(_hunkBytes <= (2u << i)) {
+			dictSize = 2u << i;
+			break;
+		}
+		if(_hunkBytes <= (3u << i)) {
+			dictSize = 3u << i;
+			break;
+		}
+	}
+
+	constexpr uint8_t lc = 3;
+	constexpr uint8_t lp = 0;
+	constexpr uint8_t pb = 2;
+	_lzmaProps[0] = (pb * 5 + lp) * 9 + lc;
+	for(int i = 0; i < 4; i++) {
+		_lzmaProps[1 + i] = (uint8_t)(dictSize >> (i * 8));
+	}
+}
+
+bool ChdReader::Inflate(const uint8_t* src, uint32_t srcSize, uint8_t* out, uint32_t outSize)
+{
+	//Raw deflate data (no zlib header)
+	return tinfl_decompress_mem_to_mem(out, outSize, src, srcSize, 0) == outSize;
+}
+
+bool ChdReader::DecompressLzma(const uint8_t* src, uint32_t srcSize, uint8_t* out, uint32_t outSize)
+{
+	ISzAlloc alloc = { SzAlloc, SzFree };
+	SizeT outLength = outSize;
+	SizeT srcLength = srcSize;
+	ELzmaStatus status;
+	SRes result = LzmaDecode(out, &outLength, src, &srcLength, _lzmaProps, LZMA_PROPS_SIZE, LZMA_FINISH_ANY, &status, &alloc);
+	return result == SZ_OK && outLength == outSize;
+}
+
+bool ChdReader::DecompressCdHunk(uint32_t codec, const uint8_t* src, uint32_t srcSize, uint8_t* out)
+{
+	//The sector data for all frames is compressed first, followed by the subcode data (which isn't used, and isn't decompressed)
+	uint32_t frameCount = _framesPerHunk;
+	uint32_t dataSize = frameCount * ChdReader::SectorDataSize;
+
+	if(codec == CdFlacCodec) {
+		//Sector data is compressed as 16-bit stereo samples, stored as big endian
+		FlacDecoder decoder;
+		if(decoder.Decode(src, srcSize, (int16_t*)out, dataSize / 4, 2) == 0) {
+			return false;
+		}
+		for(uint32_t i = 0; i < dataSize; i += 2) {
+			std::swap(out[i], out[i + 1]);
+		}
+	} else if(codec == CdZlibCodec || codec == CdLzmaCodec) {
+		//Header: 1 bit per frame (set when the sync header/ECC data was removed), followed by the compressed sector data's length
+		uint32_t eccBytes = (frameCount + 7) / 8;
+		uint32_t lengthBytes = _hunkBytes < 65536 ? 2 : 3;
+		uint32_t headerBytes = eccBytes + lengthBytes;
+		if(srcSize < headerBytes) {
+			return false;
+		}
+
+		uint32_t baseLength = (src[eccBytes] << 8) | src[eccBytes + 1];
+		if(lengthBytes > 2) {
+			baseLength = (baseLength << 8) | src[eccBytes + 2];
+		}
+		if(headerBytes + baseLength > srcSize) {
+			return false;
+		}
+
+		bool result = codec == CdLzmaCodec ? DecompressLzma(src + headerBytes, baseLength, out, dataSize) : Inflate(src + headerBytes, baseLength, out, dataSize);
+		if(!result) {
+			return false;
+		}
+
+		for(uint32_t i = 0; i < frameCount; i++) {
+			if(src[i / 8] & (1 << (i % 8))) {
+				//Restore the sync header - the ECC data isn't regenerated, the emulated drive never returns it
+				memcpy(out + i * ChdReader::SectorDataSize, CdSyncHeader, sizeof(CdSyncHeader));
+			}
+		}
+	} else {
+		return false;
+	}
+
+	//Move each frame's sector data to its final position (from the end, since the frames are moving forward)
+	for(int32_t i = (int32_t)frameCount - 1; i >= 0; i--) {
+		uint8_t* frame = out + i * ChdReader::FrameSize;
+		memmove(frame, out + i * ChdReader::SectorDataSize, ChdReader::SectorDataSize);
+		memset(frame + ChdReader::SectorDataSize, 0, ChdReader::SubcodeSize);
+	}
+	return true;
+}
+
+bool ChdReader::DecompressHunk(uint32_t hunk, uint8_t* out, uint32_t depth)
+{
+	if(hunk >= _hunkCount) {
+		return false;
+	}
+
+	MapEntry& entry = _map[hunk];
+	switch(entry.Type) {
+		case HunkType::Codec0:
+		case HunkType::Codec1:
+		case HunkType::Codec2:
+		case HunkType::Codec3:
+			if(entry.Offset > _size || entry.Length > _size - entry.Offset) {
+				return false;
+			}
+			return DecompressCdHunk(_codecs[(int)entry.Type], _data + entry.Offset, entry.Length, out);
+
+		case HunkType::Uncompressed:
+			if(entry.Offset > _size || _hunkBytes > _size - entry.Offset) {
+				return false;
+			}
+			memcpy(out, _data + entry.Offset, _hunkBytes);
+			return true;
+
+		case HunkType::Zero:
+			memset(out, 0, _hunkBytes);
+			return true;
+
+		case HunkType::Self:
+			//Same content as a previous hunk
+			return depth < 8 && DecompressHunk((uint32_t)entry.Offset, out, depth + 1);
+
+		default:
+		case HunkType::Parent:
+			return false;
+	}
+}
+
+shared_ptr<ChdReader::CachedHunk> ChdReader::GetHunk(uint32_t hunk)
+{
+	{
+		auto lock = _lock.AcquireSafe();
+		auto result = _hunks.find(hunk);
+		if(result != _hunks.end()) {
+			result->second->LastUse = ++_useCounter;
+			return result->second;
+		}
+	}
+
+	//Decompress without holding the lock, to allow other threads to read hunks that are already loaded
+	shared_ptr<CachedHunk> data(new CachedHunk());
+	data->Data.resize(_hunkBytes);
+	if(!DecompressHunk(hunk, data->Data.data(), 0)) {
+		LogDebug("[CHD] Could not decompress hunk " + std::to_string(hunk));
+		return nullptr;
+	}
+
+	auto lock = _lock.AcquireSafe();
+	data->LastUse = ++_useCounter;
+	_hunks[hunk] = data;
+
+	if(_hunks.size() > ChdReader::MaxCachedHunks) {
+		auto oldest = _hunks.begin();
+		for(auto it = _hunks.begin(); it != _hunks.end(); it++) {
+			if(it->second->LastUse < oldest->second->LastUse) {
+				oldest = it;
+			}
+		}
+		_hunks.erase(oldest);
+	}
+	return data;
+}
+
+bool ChdReader::ReadSector(uint32_t frame, uint8_t* out, uint32_t offset, uint32_t length)
+{
+	if(offset + length > ChdReader::SectorDataSize) {
+		return false;
+	}
+
+	shared_ptr<CachedHunk> hunk = GetHunk(frame / _framesPerHunk);
+	if(!hunk) {
+		return false;
+	}
+
+	const uint8_t* sector = hunk->Data.data() + (frame % _framesPerHunk) * ChdReader::FrameSize;
+
+	bool isAudio = false;
+	for(ChdTrackInfo& trk : _tracks) {
+		if(frame >= trk.FrameOffset && frame < trk.FrameOffset + trk.FrameCount) {
+			isAudio = trk.Format == TrackFormat::Audio;
+			break;
+		}
+	}
+
+	if(isAudio) {
+		//Audio samples are stored as big endian
+		for(uint32_t i = 0; i < length; i++) {
+			out[i] = sector[(offset + i) ^ 0x01];
+		}
+	} else {
+		memcpy(out, sector + offset, length);
+	}
+	return true;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include "pch.h"
+#include "Shared/CdReader.h"
+#include "Utilities/VirtualFile.h"
+#include "Utilities/SimpleLock.h"
+
+struct ChdTrackInfo
+{
+	uint32_t Number = 0;
+	TrackFormat Format = TrackFormat::Audio;
+	uint32_t FrameCount = 0; //Includes the pregap when PregapInFile is set
+	uint32_t Pregap = 0;
+	bool PregapInFile = false;
+	uint32_t Postgap = 0;
+	uint32_t FrameOffset = 0; //Index of the track's first frame in the CHD file
+};
+
+//Reads CD images stored in CHD (v5) files - decompressed hunks are kept in a small LRU cache
+//Reads are thread-safe (e.g CdSectorCache's I/O thread can decompress ahead of the emulation thread)
+class ChdReader
+{
+private:
+	static constexpr uint32_t FrameSize = 2448; //2352 bytes of sector data + 96 bytes of subcode data
+	static constexpr uint32_t SectorDataSize = 2352;
+	static constexpr uint32_t SubcodeSize = 96;
+	static constexpr uint32_t MaxCachedHunks = 32;
+	static constexpr uint32_t MaxFrameCount = 100 * 60 * 75; //100 minutes, more than any CD can hold
+
+	enum class HunkType : uint8_t
+	{
+		Codec0 = 0,
+		Codec1 = 1,
+		Codec2 = 2,
+		Codec3 = 3,
+		Uncompressed = 4,
+		Self = 5,
+		Parent = 6,
+		Zero = 0xFF
+	};
+
+	struct MapEntry
+	{
+		HunkType Type;
+		uint32_t Length;
+		uint64_t Offset;
+	};
+
+	struct CachedHunk
+	{
+		vector<uint8_t> Data;
+		uint64_t LastUse = 0;
+	};
+
+	VirtualFile _file;
+	const uint8_t* _data = nullptr;
+	size_t _size = 0;
+
+	uint32_t _codecs[4] = {};
+	uint32_t _hunkBytes = 0;
+	uint32_t _unitBytes = 0;
+	uint32_t _hunkCount = 0;
+	uint32_t _framesPerHunk = 0;
+	uint64_t _mapOffset = 0;
+	uint64_t _metaOffset = 0;
+	uint8_t _lzmaProps[5] = {};
+
+	vector<MapEntry> _map;
+	vector<ChdTrackInfo> _tracks;
+
+	SimpleLock _lock;
+	unordered_map<uint32_t, shared_ptr<CachedHunk>> _hunks;
+	uint64_t _useCounter = 0;
+
+	bool ReadHeader();
+	bool ReadMap();
+	bool ReadCompressedMap();
+	bool ReadMetadata();
+	void InitLzmaProps();
+
+	shared_ptr<CachedHunk> GetHunk(uint32_t hunk);
+	bool DecompressHunk(uint32_t hunk, uint8_t* out, uint32_t depth);
+	bool DecompressCdHunk(uint32_t codec, const uint8_t* src, uint32_t srcSize, uint8_t* out);
+	bool Inflate(const uint8_t* src, uint32_t srcSize, uint8_t* out, uint32_t outSize);
+	bool DecompressLzma(const uint8_t* src, uint32_t srcSize, uint8_t* out, uint32_t outSize);
+
+	uint64_t ReadBigEndian(uint64_t offset, uint32_t byteCount);
+
+public:
+	bool Open(VirtualFile& file);
+
+	vector<ChdTrackInfo>& GetTracks() { return _tracks; }
+
+	//Reads part of a frame's sector data (audio samples are converted to little endian)
+	bool ReadSector(uint32_t frame, uint8_t* out, uint32_t offset, uint32_t length);
+};
@@ -44,14 +44,33 @@ bool CheatManager::AddCheat(CheatCode code)
 	if(convertedCode->IsRamCode) {
 		_ramRefreshCheats[cpuIndex].push_back(convertedCode.value());
 	} else {
-		_cheatsByAddress[cpuIndex].emplace(convertedCode->Address, convertedCode.value());
+		AddCheatToBank(convertedCode.value());
 		_hasCheats[cpuIndex] = true;
-		_bankHasCheats[cpuIndex][convertedCode->Address >> GetBankShift(convertedCode->Cpu)] = true;
 	}
 
 	return true;
 }
 
+void CheatManager::AddCheatToBank(InternalCheatCode& code)
+{
+	unique_ptr<CheatBank>& bank = _cheatBanks[(int)code.Cpu][code.Address >> GetBankShift(code.Cpu)];
+	if(!bank) {
+		bank = std::make_unique<CheatBank>();
+	}
+
+	vector<InternalCheatCode>& codes = bank->Codes;
+	auto pos = std::lower_bound(codes.begin(), codes.end(), code.Address, [](const InternalCheatCode& a, uint32_t addr) { return a.Address < addr; });
+	if(pos != codes.end() && pos->Address == code.Address) {
+		//Only the first code for any given address is used
+		return;
+	}
+
+	codes.insert(pos, code);
+
+	uint8_t page = GetPageIndex(code.Cpu, code.Address);
+	bank->PageMask[page >> 6] |= 1ULL << (page & 0x3F);
+}
+
 void CheatManager::SetCheats(vector<CheatCode>& codes)
 {
 	auto lock = _emu->AcquireLock();
@@ -85,11 +104,12 @@ void CheatManager::InternalClearCheats()
 {
 	_cheats.clear();
 	for(int i = 0; i < CpuTypeUtilities::GetCpuTypeCount(); i++) {
-		_cheatsByAddress[i].clear();
 		_ramRefreshCheats[i].clear();
+		for(int j = 0; j < 0x100; j++) {
+			_cheatBanks[i][j].reset();
+		}
 	}
 	memset(_hasCheats, 0, sizeof(_hasCheats));
-	memset(_bankHasCheats, 0, sizeof(_bankHasCheats));
 }
 
 void CheatManager::ClearCheats(bool showMessage)
@@ -417,14 +437,21 @@ void CheatManager::RefreshRamCheats(CpuType cpuType)
 template<CpuType cpuType>
 void CheatManager::ApplyCheat(uint32_t addr, uint8_t& value)
 {
-	if(_bankHasCheats[(int)cpuType][addr >> GetBankShift(cpuType)]) {
-		auto result = _cheatsByAddress[(int)cpuType].find(addr);
-		if(result != _cheatsByAddress[(int)cpuType].end()) {
-			if(result->second.Compare == -1 || result->second.Compare == value) {
-				value = result->second.Value;
-				_emu->GetConsoleUnsafe()->ProcessCheatCode(result->second, addr, value);
-			}
-		}
+	CheatBank* bank = _cheatBanks[(int)cpuType][addr >> GetBankShift(cpuType)].get();
+	if(!bank) {
+		return;
+	}
+
+	uint8_t page = GetPageIndex(cpuType, addr);
+	if(!(bank->PageMask[page >> 6] & (1ULL << (page & 0x3F)))) {
+		return;
+	}
+
+	vector<InternalCheatCode>& codes = bank->Codes;
+	auto code = std::lower_bound(codes.begin(), codes.end(), addr, [](const InternalCheatCode& a, uint32_t address) { return a.Address < address; });
+	if(code != codes.end() && code->Address == addr && (code->Compare == -1 || code->Compare == value)) {
+		value = code->Value;
+		_emu->GetConsoleUnsafe()->ProcessCheatCode(*code, addr, value);
 	}
 }
 
@@ -33,6 +33,16 @@ struct InternalCheatCode
 	bool IsAbsoluteAddress = false;
 };
 
+//Cheat codes for one bank of a CPU's address space
+struct CheatBank
+{
+	//1 bit per 1/256th of the bank, set when at least one code targets that part of the bank
+	uint64_t PageMask[4] = {};
+	
+	//Codes sorted by address, at most 1 code per address
+	vector<InternalCheatCode> Codes;
+};
+
 struct CheatCode
 {
 	CheatType Type;
@@ -44,13 +54,14 @@ class CheatManager
 private:
 	Emulator* _emu;
 	bool _hasCheats[CpuTypeUtilities::GetCpuTypeCount()] = {};
-	bool _bankHasCheats[CpuTypeUtilities::GetCpuTypeCount()][0x100] = {};
+	unique_ptr<CheatBank> _cheatBanks[CpuTypeUtilities::GetCpuTypeCount()][0x100];
 	
 	vector<CheatCode> _cheats;
 
 	vector<InternalCheatCode> _ramRefreshCheats[CpuTypeUtilities::GetCpuTypeCount()];
-	unordered_map<uint32_t, InternalCheatCode> _cheatsByAddress[CpuTypeUtilities::GetCpuTypeCount()];
 	
+	void AddCheatToBank(InternalCheatCode& code);
+
 	optional<InternalCheatCode> TryConvertCode(CheatCode code);
 	
 	optional<InternalCheatCode> ConvertFromSnesGameGenie(string code);
@@ -77,6 +88,12 @@ private:
 		}
 	}
 
+	__forceinline constexpr uint8_t GetPageIndex(CpuType cpuType, uint32_t addr)
+	{
+		//Splits each bank into 256 pages (1 byte per page for NES/GB, 32 bytes for PCE, 256 bytes for SNES)
+		return (uint8_t)(addr >> (GetBankShift(cpuType) - 8));
+	}
+
 public:
 	CheatManager(Emulator* emu);
 
@@ -2,10 +2,13 @@
 
 #include "pch.h"
 
+class AudioTelemetry;
+
 struct AudioStatistics
 {
 	double AverageLatency = 0;
 	uint32_t BufferUnderrunEventCount = 0;
+	uint32_t BufferOverrunEventCount = 0;
 	uint32_t BufferSize = 0;
 };
 
@@ -22,4 +25,5 @@ public:
 	virtual void SetAudioDevice(string deviceName) = 0;
 
 	virtual AudioStatistics GetStatistics() = 0;
+	virtual AudioTelemetry* GetTelemetry() { return nullptr; }
 };
\ No newline at end of file
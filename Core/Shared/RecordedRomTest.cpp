@@ -128,7 +128,10 @@ void RecordedRomTest::Record(string filename, bool reset)
 		_emu->GetSettings()->GetSnesConfig().DisableFrameSkipping = true;
 
 		_emu->GetSettings()->GetNesConfig().RamPowerOnState = RamState::AllZeros;
+		_emu->GetSettings()->GetNesConfig().DisableFrameSkipping = true;
+
 		_emu->GetSettings()->GetGameboyConfig().RamPowerOnState = RamState::AllZeros;
+		_emu->GetSettings()->GetGameboyConfig().DisableFrameSkipping = true;
 		
 		_emu->GetSettings()->GetPcEngineConfig().RamPowerOnState = RamState::AllZeros;
 		_emu->GetSettings()->GetPcEngineConfig().DisableFrameSkipping = true;
@@ -211,7 +214,10 @@ RomTestResult RecordedRomTest::Run(string filename)
 		settings->GetSnesConfig().DisableFrameSkipping = true;
 
 		settings->GetNesConfig().RamPowerOnState = RamState::AllZeros;
+		settings->GetNesConfig().DisableFrameSkipping = true;
+
 		settings->GetGameboyConfig().RamPowerOnState = RamState::AllZeros;
+		settings->GetGameboyConfig().DisableFrameSkipping = true;
 
 		settings->GetPcEngineConfig().RamPowerOnState = RamState::AllZeros;
 		settings->GetPcEngineConfig().DisableFrameSkipping = true;
@@ -221,6 +227,7 @@ RomTestResult RecordedRomTest::Run(string filename)
 		if(_emu->LoadRom(testRom, VirtualFile(""))) {
 			_emu->GetMovieManager()->Play(testMovie, true);
 			settings->SetFlag(EmulationFlags::MaximumSpeed);
+			settings->SetFlag(EmulationFlags::SkipAudioSynthesis);
 
 			_runningTest = true;
 			_emu->Unlock();
@@ -235,6 +242,7 @@ RomTestResult RecordedRomTest::Run(string filename)
 		}
 
 		settings->ClearFlag(EmulationFlags::MaximumSpeed);
+		settings->ClearFlag(EmulationFlags::SkipAudioSynthesis);
 
 		result.ErrorCode = _badFrameCount;
 		result.State = _badFrameCount == 0 ? RomTestState::Passed : (_isLastFrameGood ? RomTestState::PassedWithWarnings : RomTestState::Failed);
@@ -10,6 +10,7 @@ enum class EmulationFlags
 	MaximumSpeed = 0x04,
 	InBackground = 0x08,
 	ConsoleMode = 0x10,
+	SkipAudioSynthesis = 0x20,
 };
 
 enum class ScaleFilterType
@@ -113,6 +114,14 @@ struct VideoConfig
 	uint32_t ScreenRotation = 0;
 };
 
+enum class AudioResamplerType
+{
+	Hermite,
+	SincLow,
+	SincMedium,
+	SincHigh
+};
+
 struct AudioConfig
 {
 	const char* AudioDevice = nullptr;
@@ -122,10 +131,12 @@ struct AudioConfig
 	uint32_t MasterVolume = 100;
 	uint32_t SampleRate = 48000;
 	uint32_t AudioLatency = 60;
+	AudioResamplerType Resampler = AudioResamplerType::Hermite;
 
 	bool MuteSoundInBackground = false;
 	bool ReduceSoundInBackground = true;
 	bool ReduceSoundInFastForward = false;
+	bool SkipSynthesisInFastForward = false;
 	uint32_t VolumeReduction = 75;
 
 	bool ReverbEnabled = false;
@@ -383,6 +394,7 @@ struct GameboyConfig
 	bool DisableBackground = false;
 	bool DisableSprites = false;
 	bool HideSgbBorders = false;
+	bool DisableFrameSkipping = false;
 
 	RamState RamPowerOnState = RamState::Random;
 	bool AllowInvalidInput = false;
@@ -526,6 +538,7 @@ struct NesConfig
 
 	ConsoleRegion Region = ConsoleRegion::Auto;
 	bool EnableHdPacks = true;
+	uint32_t HdPackSfxCacheSize = 64; //in MB
 	bool DisableGameDatabase = false;
 	bool FdsAutoLoadDisk = true;
 	bool FdsFastForwardOnLoad = false;
@@ -540,6 +553,7 @@ struct NesConfig
 	bool RemoveSpriteLimit = false;
 	bool AdaptiveSpriteLimit = false;
 	bool EnablePalBorders = false;
+	bool DisableFrameSkipping = false;
 	
 	bool UseCustomVsPalette = false;
 	
@@ -0,0 +1,31 @@
+#include "pch.h"
+#include "Shared/Video/FrameSkipHelper.h"
+#include "Shared/Video/VideoRenderer.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/RewindManager.h"
+
+bool FrameSkipHelper::ProcessStartFrame(Emulator* emu, bool allowSkip)
+{
+	if(!_skipFrame) {
+		//The previous frame was displayed
+		_timer.Reset();
+	}
+
+	if(!allowSkip) {
+		//The console needs every frame to be drawn (e.g light guns, SGB, debugger, frame skipping disabled)
+		_skipFrame = false;
+	} else if(emu->IsRunAheadFrame()) {
+		_skipFrame = true;
+	} else {
+		//Draw at most one frame every 10ms when fast forwarding - the other frames would never be displayed anyway
+		uint32_t emulationSpeed = emu->GetSettings()->GetEmulationSpeed();
+		_skipFrame = (
+			!emu->GetRewindManager()->IsRewinding() &&
+			!emu->GetVideoRenderer()->IsRecording() &&
+			(emulationSpeed == 0 || emulationSpeed > 150) &&
+			_timer.GetElapsedMS() < 10
+		);
+	}
+	return _skipFrame;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/Timer.h"
+
+class Emulator;
+
+//Decides which frames the PPUs can skip while fast forwarding.
+//Skipped frames keep all of the timing-visible PPU behavior (status flags, IRQs, etc.), the PPUs only
+//skip the final pixel composition/output and don't send the frame to the video decoder.
+class FrameSkipHelper
+{
+private:
+	Timer _timer;
+	bool _skipFrame = false;
+
+public:
+	//Called at the start of each frame, returns true if the new frame doesn't need to be drawn
+	//When allowSkip is false (console-specific conditions), every frame is drawn, including run-ahead frames
+	bool ProcessStartFrame(Emulator* emu, bool allowSkip);
+};
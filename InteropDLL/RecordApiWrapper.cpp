@@ -2,6 +2,7 @@
 #include "Core/Shared/Emulator.h"
 #include "Core/Shared/Video/VideoRenderer.h"
 #include "Core/Shared/Audio/SoundMixer.h"
+#include "Core/Shared/Audio/AudioTelemetry.h"
 #include "Core/Shared/Movies/MovieManager.h"
 
 extern unique_ptr<Emulator> _emu;
@@ -16,6 +17,31 @@ extern "C"
 	DllExport void __stdcall WaveStop() { _emu->GetSoundMixer()->StopRecording(); }
 	DllExport bool __stdcall WaveIsRecording() { return _emu->GetSoundMixer()->IsRecording(); }
 
+	DllExport void __stdcall GetAudioTelemetry(AudioTelemetryData& data)
+	{
+		AudioTelemetry* telemetry = _emu->GetSoundMixer()->GetTelemetry();
+		data = telemetry ? telemetry->GetLastSecond() : AudioTelemetryData();
+	}
+
+	DllExport bool __stdcall AudioTelemetryLogStart(char* filename)
+	{
+		AudioTelemetry* telemetry = _emu->GetSoundMixer()->GetTelemetry();
+		return telemetry ? telemetry->StartLog(filename) : false;
+	}
+
+	DllExport void __stdcall AudioTelemetryLogStop()
+	{
+		if(AudioTelemetry* telemetry = _emu->GetSoundMixer()->GetTelemetry()) {
+			telemetry->StopLog();
+		}
+	}
+
+	DllExport bool __stdcall AudioTelemetryIsLogging()
+	{
+		AudioTelemetry* telemetry = _emu->GetSoundMixer()->GetTelemetry();
+		return telemetry ? telemetry->IsLogging() : false;
+	}
+
 	DllExport void __stdcall MoviePlay(char* filename) { _emu->GetMovieManager()->Play(string(filename)); }
 	DllExport void __stdcall MovieStop() { _emu->GetMovieManager()->Stop(); }
 	DllExport bool __stdcall MoviePlaying() { return _emu->GetMovieManager()->Playing(); }
@@ -7,6 +7,7 @@
 SdlSoundManager::SdlSoundManager(Emulator* emu)
 {
 	_emu = emu;
+	_playing = false;
 
 	if(InitializeAudio(44100, false)) {
 		_emu->GetSoundMixer()->RegisterAudioDevice(this);
@@ -22,6 +23,7 @@ void SdlSoundManager::FillAudioBuffer(void *userData, uint8_t *stream, int len)
 {
 	SdlSoundManager* soundManager = (SdlSoundManager*)userData;
 
+	soundManager->_telemetry.RecordCallback();
 	soundManager->ReadFromBuffer(stream, len);
 }
 
@@ -32,11 +34,8 @@ void SdlSoundManager::Release()
 		SDL_CloseAudioDevice(_audioDeviceID);
 	}
 
-	if(_buffer) {
-		delete[] _buffer;
-		_buffer = nullptr;
-		_bufferSize = 0;
-	}
+	_buffer.Resize(0, 1);
+	_bufferSize = 0;
 }
 
 bool SdlSoundManager::InitializeAudio(uint32_t sampleRate, bool isStereo)
@@ -55,8 +54,7 @@ bool SdlSoundManager::InitializeAudio(uint32_t sampleRate, bool isStereo)
 	int bytesPerSample = 2 * (isStereo ? 2 : 1);
 	int32_t requestedByteLatency = (int32_t)((float)(sampleRate * _previousLatency) / 1000.0f * bytesPerSample);
 	_bufferSize = (int32_t)std::ceil((double)requestedByteLatency * 2 / 0x10000) * 0x10000;
-	_buffer = new uint8_t[_bufferSize];
-	memset(_buffer, 0, _bufferSize);
+	_buffer.Resize(_bufferSize, bytesPerSample);
 
 	SDL_AudioSpec audioSpec;
 	SDL_memset(&audioSpec, 0, sizeof(audioSpec));
@@ -75,9 +73,7 @@ bool SdlSoundManager::InitializeAudio(uint32_t sampleRate, bool isStereo)
 		_audioDeviceID = SDL_OpenAudioDevice(nullptr, isCapture, &audioSpec, &obtainedSpec, 0);
 	}
 
-	_writePosition = 0;
-	_readPosition = 0;
-
+	_playing = false;
 	_needReset = false;
 
 	return _audioDeviceID != 0;
@@ -119,33 +115,18 @@ void SdlSoundManager::SetAudioDevice(string deviceName)
 
 void SdlSoundManager::ReadFromBuffer(uint8_t* output, uint32_t len)
 {
-	if(_readPosition + len < _bufferSize) {
-		memcpy(output, _buffer+_readPosition, len);
-		_readPosition += len;
-	} else {
-		int remainingBytes = (_bufferSize - _readPosition);
-		memcpy(output, _buffer+_readPosition, remainingBytes);
-		memcpy(output+remainingBytes, _buffer, len - remainingBytes);
-		_readPosition = len - remainingBytes;
-	}
-
-	if(_readPosition >= _writePosition && _readPosition - _writePosition < _bufferSize / 2) {
-		_bufferUnderrunEventCount++;
+	uint32_t count = _buffer.Read(output, len);
+	if(count < len) {
+		//Not enough data (underrun), output silence for the rest of the request
+		memset(output + count, 0, len - count);
 	}
 }
 
 void SdlSoundManager::WriteToBuffer(uint8_t* input, uint32_t len)
 {
-	if(_writePosition + len < _bufferSize) {
-		memcpy(_buffer+_writePosition, input, len);
-		_writePosition += len;
-	} else {
-		int remainingBytes = _bufferSize - _writePosition;
-		memcpy(_buffer+_writePosition, input, remainingBytes);
-		memcpy(_buffer, ((uint8_t*)input)+remainingBytes, len - remainingBytes);
-		_writePosition = len - remainingBytes;
-	}
+	_buffer.Write(input, len);
 }
+
 void SdlSoundManager::PlayBuffer(int16_t *soundBuffer, uint32_t sampleCount, uint32_t sampleRate, bool isStereo)
 {
 	uint32_t bytesPerSample = 2 * (isStereo ? 2 : 1);
@@ -157,35 +138,34 @@ void SdlSoundManager::PlayBuffer(int16_t *soundBuffer, uint32_t sampleCount, uin
 
 	WriteToBuffer((uint8_t*)soundBuffer, sampleCount * bytesPerSample);
 
-	int32_t byteLatency = (int32_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
-	int32_t playWriteByteLatency = _writePosition - _readPosition;
-	if(playWriteByteLatency < 0) {
-		playWriteByteLatency = _bufferSize - _readPosition + _writePosition;
-	}
-
-	if(playWriteByteLatency > byteLatency) {
+	uint32_t byteLatency = (uint32_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
+	if(!_playing && _buffer.GetFillLevel() > byteLatency) {
 		//Start playing
+		_playing = true;
 		SDL_PauseAudioDevice(_audioDeviceID, 0);
 	}
 }
 
 void SdlSoundManager::Pause()
 {
+	//SDL_PauseAudioDevice waits for the audio callback to complete before returning
 	SDL_PauseAudioDevice(_audioDeviceID, 1);
+	_playing = false;
 }
 
 void SdlSoundManager::Stop()
 {
 	Pause();
 
-	_readPosition = 0;
-	_writePosition = 0;
+	_buffer.Clear();
 	ResetStats();
 }
 
 void SdlSoundManager::ProcessEndOfFrame()
 {
-	ProcessLatency(_readPosition, _writePosition);
+	_bufferUnderrunEventCount = _buffer.GetUnderrunCount();
+	_bufferOverrunEventCount = _buffer.GetOverrunCount();
+	ProcessLatency(_buffer.GetFillLevel());
 
 	uint32_t emulationSpeed = _emu->GetSettings()->GetEmulationSpeed();
 	if(_averageLatency > 0 && emulationSpeed <= 100 && emulationSpeed > 0 && std::abs(_averageLatency - _emu->GetSettings()->GetAudioConfig().AudioLatency) > 50) {
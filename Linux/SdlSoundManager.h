@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "SDL.h"
 #include "Core/Shared/Audio/BaseSoundManager.h"
+#include "Utilities/SpscRingBuffer.h"
 
 class Emulator;
 
@@ -27,7 +28,7 @@ private:
 	static void FillAudioBuffer(void *userData, uint8_t *stream, int len);
 
 	void ReadFromBuffer(uint8_t* output, uint32_t len);
-	void WriteToBuffer(uint8_t* output, uint32_t len);
+	void WriteToBuffer(uint8_t* input, uint32_t len);
 
 private:
 	Emulator* _emu;
@@ -37,7 +38,7 @@ private:
 
 	uint16_t _previousLatency = 0;
 
-	uint8_t* _buffer = nullptr;
-	uint32_t _writePosition = 0;
-	uint32_t _readPosition = 0;
+	//Written by the emulation thread, read by SDL's audio callback thread
+	SpscRingBuffer _buffer;
+	atomic<bool> _playing;
 };
@@ -19,10 +19,12 @@ namespace Mesen.Config
 		[Reactive] [MinMax(0, 100)] public UInt32 MasterVolume { get; set; } = 100;
 		[Reactive] public AudioSampleRate SampleRate { get; set; } = AudioSampleRate._48000;
 		[Reactive] [MinMax(15, 300)] public UInt32 AudioLatency { get; set; } = 60;
+		[Reactive] public AudioResamplerType Resampler { get; set; } = AudioResamplerType.Hermite;
 
 		[Reactive] public bool MuteSoundInBackground { get; set; } = false;
 		[Reactive] public bool ReduceSoundInBackground { get; set; } = true;
 		[Reactive] public bool ReduceSoundInFastForward { get; set; } = false;
+		[Reactive] public bool SkipSynthesisInFastForward { get; set; } = false;
 		[Reactive] [MinMax(0, 100)] public int VolumeReduction { get; set; } = 75;
 
 		[Reactive] public bool ReverbEnabled { get; set; } = false;
@@ -69,10 +71,12 @@ namespace Mesen.Config
 				MasterVolume = MasterVolume,
 				SampleRate = (UInt32)SampleRate,
 				AudioLatency = AudioLatency,
+				Resampler = Resampler,
 
 				MuteSoundInBackground = MuteSoundInBackground,
 				ReduceSoundInBackground = ReduceSoundInBackground,
 				ReduceSoundInFastForward = ReduceSoundInFastForward,
+				SkipSynthesisInFastForward = SkipSynthesisInFastForward,
 				VolumeReduction = VolumeReduction,
 
 				ReverbEnabled = ReverbEnabled,
@@ -121,10 +125,12 @@ namespace Mesen.Config
 		public UInt32 MasterVolume;
 		public UInt32 SampleRate;
 		public UInt32 AudioLatency;
+		public AudioResamplerType Resampler;
 
 		[MarshalAs(UnmanagedType.I1)] public bool MuteSoundInBackground;
 		[MarshalAs(UnmanagedType.I1)] public bool ReduceSoundInBackground;
 		[MarshalAs(UnmanagedType.I1)] public bool ReduceSoundInFastForward;
+		[MarshalAs(UnmanagedType.I1)] public bool SkipSynthesisInFastForward;
 		public int VolumeReduction;
 
 		[MarshalAs(UnmanagedType.I1)] public bool ReverbEnabled;
@@ -162,6 +168,14 @@ namespace Mesen.Config
 		public UInt32 AudioPlayerSilenceDelay;
 	}
 
+	public enum AudioResamplerType
+	{
+		Hermite,
+		SincLow,
+		SincMedium,
+		SincHigh
+	}
+
 	public enum AudioSampleRate
 	{
 		_11025 = 11025,
@@ -22,6 +22,7 @@ namespace Mesen.Config
 		[Reactive] public bool DisableBackground { get; set; } = false;
 		[Reactive] public bool DisableSprites { get; set; } = false;
 		[Reactive] public bool HideSgbBorders { get; set; } = false;
+		[Reactive] public bool DisableFrameSkipping { get; set; } = false;
 
 		[Reactive] public RamState RamPowerOnState { get; set; } = RamState.Random;
 		[Reactive] public bool AllowInvalidInput { get; set; } = false;
@@ -47,6 +48,7 @@ namespace Mesen.Config
 				DisableBackground = DisableBackground,
 				DisableSprites = DisableSprites,
 				HideSgbBorders = HideSgbBorders,
+				DisableFrameSkipping = DisableFrameSkipping,
 
 				RamPowerOnState = RamPowerOnState,
 				AllowInvalidInput = AllowInvalidInput,
@@ -117,6 +119,7 @@ namespace Mesen.Config
 		[MarshalAs(UnmanagedType.I1)] public bool DisableBackground;
 		[MarshalAs(UnmanagedType.I1)] public bool DisableSprites;
 		[MarshalAs(UnmanagedType.I1)] public bool HideSgbBorders;
+		[MarshalAs(UnmanagedType.I1)] public bool DisableFrameSkipping;
 
 		public RamState RamPowerOnState;
 		[MarshalAs(UnmanagedType.I1)] public bool AllowInvalidInput;
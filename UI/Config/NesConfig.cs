@@ -35,6 +35,7 @@ namespace Mesen.Config
 		//General
 		[Reactive] public ConsoleRegion Region { get; set; } = ConsoleRegion.Auto;
 		[Reactive] public bool EnableHdPacks { get; set; } = true;
+		[Reactive][MinMax(0, 1024)] public UInt32 HdPackSfxCacheSize { get; set; } = 64;
 		[Reactive] public bool DisableGameDatabase { get; set; } = false;
 		[Reactive] public bool FdsAutoLoadDisk { get; set; } = true;
 		[Reactive] public bool FdsFastForwardOnLoad { get; set; } = false;
@@ -50,6 +51,7 @@ namespace Mesen.Config
 		[Reactive] public bool RemoveSpriteLimit { get; set; } = false;
 		[Reactive] public bool AdaptiveSpriteLimit { get; set; } = false;
 		[Reactive] public bool EnablePalBorders { get; set; } = false;
+		[Reactive] public bool DisableFrameSkipping { get; set; } = false;
 
 		[Reactive] public bool UseCustomVsPalette { get; set; } = false;
 
@@ -149,6 +151,7 @@ namespace Mesen.Config
 
 				Region = Region,
 				EnableHdPacks = EnableHdPacks,
+				HdPackSfxCacheSize = HdPackSfxCacheSize,
 				DisableGameDatabase = DisableGameDatabase,
 				FdsAutoLoadDisk = FdsAutoLoadDisk,
 				FdsFastForwardOnLoad = FdsFastForwardOnLoad,
@@ -163,6 +166,7 @@ namespace Mesen.Config
 				RemoveSpriteLimit = RemoveSpriteLimit,
 				AdaptiveSpriteLimit = AdaptiveSpriteLimit,
 				EnablePalBorders = EnablePalBorders,
+				DisableFrameSkipping = DisableFrameSkipping,
 
 				UseCustomVsPalette = UseCustomVsPalette,
 
@@ -315,6 +319,7 @@ namespace Mesen.Config
 
 		public ConsoleRegion Region;
 		[MarshalAs(UnmanagedType.I1)] public bool EnableHdPacks;
+		public UInt32 HdPackSfxCacheSize;
 		[MarshalAs(UnmanagedType.I1)] public bool DisableGameDatabase;
 		[MarshalAs(UnmanagedType.I1)] public bool FdsAutoLoadDisk;
 		[MarshalAs(UnmanagedType.I1)] public bool FdsFastForwardOnLoad;
@@ -329,6 +334,7 @@ namespace Mesen.Config
 		[MarshalAs(UnmanagedType.I1)] public bool RemoveSpriteLimit;
 		[MarshalAs(UnmanagedType.I1)] public bool AdaptiveSpriteLimit;
 		[MarshalAs(UnmanagedType.I1)] public bool EnablePalBorders;
+		[MarshalAs(UnmanagedType.I1)] public bool DisableFrameSkipping;
 		
 		[MarshalAs(UnmanagedType.I1)] public bool UseCustomVsPalette;
 
@@ -341,6 +341,14 @@ namespace Mesen.Debugger.ViewModels
 					}
 				}
 			}
+
+			if(CpuType == CpuType.Pce) {
+				//Host-side CD read cache statistics (only shown when a CD game is loaded)
+				CdSectorCacheStats cacheStats = DebugApi.GetCdSectorCacheStats();
+				if(cacheStats.HitCount + cacheStats.MissCount > 0) {
+					statsString += $" CD Cache: {cacheStats.HitCount} hits, {cacheStats.MissCount} misses, longest stall: {cacheStats.MaxStallUs / 1000:0.00} ms";
+				}
+			}
 			CdlStats = statsString;
 		}
 
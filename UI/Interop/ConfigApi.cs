@@ -53,6 +53,7 @@ namespace Mesen.Interop
 		MaximumSpeed = 0x04,
 		InBackground = 0x08,
 		ConsoleMode = 0x10,
+		SkipAudioSynthesis = 0x20,
 	}
 
 	public enum DebuggerFlags : UInt32
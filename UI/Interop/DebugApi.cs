@@ -185,6 +185,8 @@ namespace Mesen.Interop
 			return Marshal.PtrToStructure<T>((IntPtr)ptr);
 		}
 
+		[DllImport(DllPath)] public static extern CdSectorCacheStats GetCdSectorCacheStats();
+
 		[DllImport(DllPath)] public static extern void SetProgramCounter(CpuType cpuType, UInt32 address);
 		[DllImport(DllPath)] public static extern UInt32 GetProgramCounter(CpuType cpuType, [MarshalAs(UnmanagedType.I1)] bool getInstPc);
 
@@ -1361,6 +1363,14 @@ namespace Mesen.Interop
 		public UInt32 TotalChrBytes;
 	}
 
+	public struct CdSectorCacheStats
+	{
+		public UInt64 HitCount;
+		public UInt64 MissCount;
+		public UInt64 PrefetchedBlockCount;
+		public double MaxStallUs;
+	}
+
 	public struct ProfiledFunction
 	{
 		public UInt64 ExclusiveCycles;
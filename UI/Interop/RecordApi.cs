@@ -20,6 +20,11 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern void WaveStop();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool WaveIsRecording();
 
+		[DllImport(DllPath)] public static extern void GetAudioTelemetry(out AudioTelemetryData data);
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool AudioTelemetryLogStart([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
+		[DllImport(DllPath)] public static extern void AudioTelemetryLogStop();
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool AudioTelemetryIsLogging();
+
 		[DllImport(DllPath)] public static extern void MoviePlay([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
 		[DllImport(DllPath)] public static extern void MovieRecord(RecordMovieOptions options);
 		[DllImport(DllPath)] public static extern void MovieStop();
@@ -69,6 +74,29 @@ namespace Mesen.Interop
 		public RecordMovieFrom RecordFrom;
 	}
 
+	public struct AudioTelemetryData
+	{
+		public const int BinCount = 16;
+
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = BinCount)]
+		public UInt32[] FillLevel;
+
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = BinCount)]
+		public UInt32[] CallbackJitter;
+
+		[MarshalAs(UnmanagedType.ByValArray, SizeConst = BinCount)]
+		public UInt32[] RateAdjustment;
+
+		public UInt32 UnderrunCount;
+		public UInt32 OverrunCount;
+		public UInt32 FrameCount;
+		public UInt32 CallbackCount;
+
+		public UInt32 StreamSeekCount;
+		public UInt32 StreamSeekMaxLatencyUs;
+		public UInt32 StreamSeekTotalLatencyUs;
+	}
+
 	public struct RecordAviOptions
 	{
 		public VideoCodec Codec;
@@ -14,7 +14,7 @@ namespace Mesen.Utilities
 			".sfc", ".smc", ".fig", ".swc", ".bs",
 			".gb", ".gbc",
 			".nes", ".unif", ".unf", ".fds", ".studybox",
-			".pce", ".sgx", ".cue"
+			".pce", ".sgx", ".cue", ".chd"
 		};
 
 		public static bool IsRomFile(string path)
@@ -46,6 +46,7 @@ namespace Mesen.Utilities
 
 			ConfigApi.SetEmulationFlag(EmulationFlags.ConsoleMode, true);
 			ConfigApi.SetEmulationFlag(EmulationFlags.MaximumSpeed, true);
+			ConfigApi.SetEmulationFlag(EmulationFlags.SkipAudioSynthesis, true);
 			EmuApi.Resume();
 
 			int result = -1;
@@ -1,15 +1,14 @@
 #include "pch.h"
 #include "CrossFeedFilter.h"
 
-void CrossFeedFilter::ApplyFilter(int16_t *stereoBuffer, size_t sampleCount, int ratio)
+void CrossFeedFilter::ApplyFilter(float* stereoBuffer, size_t sampleCount, int ratio)
 {
-	for(size_t i = 0; i < sampleCount; i++) {
-		int16_t leftSample = stereoBuffer[0];
-		int16_t rightSample = stereoBuffer[1];
+	float feed = ratio / 100.0f;
+	for(size_t i = 0; i < sampleCount * 2; i += 2) {
+		float leftSample = stereoBuffer[i];
+		float rightSample = stereoBuffer[i + 1];
 
-		stereoBuffer[0] += rightSample * ratio / 100;
-		stereoBuffer[1] += leftSample * ratio / 100;
-
-		stereoBuffer += 2;
+		stereoBuffer[i] = leftSample + rightSample * feed;
+		stereoBuffer[i + 1] = rightSample + leftSample * feed;
 	}
 }
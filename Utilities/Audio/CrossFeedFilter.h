@@ -3,5 +3,5 @@
 class CrossFeedFilter
 {
 public:
-	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, int ratio);
-};
\ No newline at end of file
+	void ApplyFilter(float* stereoBuffer, size_t sampleCount, int ratio);
+};
@@ -2,18 +2,104 @@
 #include "Equalizer.h"
 #include "orfanidis_eq.h"
 
-void Equalizer::ApplyEqualizer(uint32_t sampleCount, int16_t *samples)
+void Equalizer::ApplyEqualizer(uint32_t sampleCount, float *samples)
 {
-	double outL, outR;
+	//Prevent denormalized values (causes extreme performance loss)
+	constexpr double denormalThreshold = 0.000000000001;
+
+	alignas(32) double x[LaneCount];
 	for(uint32_t i = 0; i < sampleCount; i++) {
-		double inL = samples[i * 2];
-		double inR = samples[i * 2 + 1];
-			
-		_equalizerLeft->sbs_process(&inL, &outL);
-		_equalizerRight->sbs_process(&inR, &outR);
-
-		samples[i * 2] = (int16_t)std::max(std::min(outL, 32767.0), -32768.0);
-		samples[i * 2 + 1] = (int16_t)std::max(std::min(outR, 32767.0), -32768.0);
+		std::fill(x, x + LanesPerChannel, samples[i * 2]);
+		std::fill(x + LanesPerChannel, x + LaneCount, samples[i * 2 + 1]);
+
+		//Process the sections in serial, with all bands of both channels processed in parallel
+		for(FilterSection& s : _sections) {
+			for(int j = 0; j < LaneCount; j++) {
+				double in = x[j];
+				double out = s.B[0][j] * in;
+				out += s.B[1][j] * s.In[0][j] - s.A[0][j] * s.Out[0][j];
+				out += s.B[2][j] * s.In[1][j] - s.A[1][j] * s.Out[1][j];
+				out += s.B[3][j] * s.In[2][j] - s.A[2][j] * s.Out[2][j];
+				out += s.B[4][j] * s.In[3][j] - s.A[3][j] * s.Out[3][j];
+
+				s.In[3][j] = s.In[2][j];
+				s.In[2][j] = s.In[1][j];
+				s.In[1][j] = s.In[0][j];
+				s.In[0][j] = std::abs(in) < denormalThreshold ? 0.0 : in;
+
+				out = std::abs(out) < denormalThreshold ? 0.0 : out;
+				s.Out[3][j] = s.Out[2][j];
+				s.Out[2][j] = s.Out[1][j];
+				s.Out[1][j] = s.Out[0][j];
+				s.Out[0][j] = out;
+
+				x[j] = out;
+			}
+		}
+
+		//Sum the bands (8 partial sums per channel to keep the reduction vectorizable)
+		alignas(32) double left[8] = {};
+		alignas(32) double right[8] = {};
+		for(int j = 0; j < LanesPerChannel; j += 8) {
+			for(int k = 0; k < 8; k++) {
+				left[k] += _gains[j + k] * x[j + k];
+				right[k] += _gains[LanesPerChannel + j + k] * x[LanesPerChannel + j + k];
+			}
+		}
+
+		samples[i * 2] = (float)(((left[0] + left[1]) + (left[2] + left[3])) + ((left[4] + left[5]) + (left[6] + left[7])));
+		samples[i * 2 + 1] = (float)(((right[0] + right[1]) + (right[2] + right[3])) + ((right[4] + right[5]) + (right[6] + right[7])));
+	}
+}
+
+void Equalizer::SetBandCoefficients(int band, double w0, double wb)
+{
+	//Same butterworth band filter design as orfanidis_eq's butterworth_bp_filter/butterworth_fo_section, computed
+	//here to fill the structure-of-arrays sections used by ApplyEqualizer (the library doesn't expose its coefficients)
+	constexpr unsigned int N = orfanidis_eq::default_eq_band_filters_order;
+	double G = orfanidis_eq::conversions::db_2_lin(orfanidis_eq::max_base_gain_db);
+	double Gb = orfanidis_eq::conversions::db_2_lin(orfanidis_eq::butterworth_band_gain_db);
+	double G0 = orfanidis_eq::conversions::db_2_lin(orfanidis_eq::min_base_gain_db);
+
+	double epsilon = pow((G * G - Gb * Gb) / (Gb * Gb - G0 * G0), 0.5);
+	double g = pow(G, 1.0 / N);
+	double g0 = pow(G0, 1.0 / N);
+	double beta = pow(epsilon, -1.0 / N) * tan(wb / 2.0);
+
+	double c0 = cos(w0);
+	if(w0 == 0) c0 = 1;
+	if(w0 == orfanidis_eq::pi / 2) c0 = 0;
+	if(w0 == orfanidis_eq::pi) c0 = -1;
+
+	for(int i = 1; i <= SectionCount; i++) {
+		double ui = (2.0 * i - 1) / N;
+		double s = sin(orfanidis_eq::pi * ui / 2.0);
+		double D = beta * beta + 2 * s * beta + 1;
+
+		double b[5] = {
+			(g * g * beta * beta + 2 * g * g0 * s * beta + g0 * g0) / D,
+			-4 * c0 * (g0 * g0 + g * g0 * s * beta) / D,
+			2 * (g0 * g0 * (1 + 2 * c0 * c0) - g * g * beta * beta) / D,
+			-4 * c0 * (g0 * g0 - g * g0 * s * beta) / D,
+			(g * g * beta * beta - 2 * g * g0 * s * beta + g0 * g0) / D
+		};
+
+		double a[4] = {
+			-4 * c0 * (1 + s * beta) / D,
+			2 * (1 + 2 * c0 * c0 - beta * beta) / D,
+			-4 * c0 * (1 - s * beta) / D,
+			(beta * beta - 2 * s * beta + 1) / D
+		};
+
+		FilterSection& section = _sections[i - 1];
+		for(int lane : { band, band + LanesPerChannel }) {
+			for(int k = 0; k < 5; k++) {
+				section.B[k][lane] = b[k];
+			}
+			for(int k = 0; k < 4; k++) {
+				section.A[k][lane] = a[k];
+			}
+		}
 	}
 }
 
@@ -24,19 +110,28 @@ void Equalizer::UpdateEqualizers(vector<double> bandGains, uint32_t sampleRate)
 		bands.insert(bands.begin(), bands[0] - (bands[1] - bands[0]));
 		bands.insert(bands.end(), bands[bands.size() - 1] + (bands[bands.size() - 1] - bands[bands.size() - 2]));
 
-		_eqFrequencyGrid.reset(new orfanidis_eq::freq_grid());
+		orfanidis_eq::freq_grid eqFrequencyGrid;
 		for(size_t i = 1; i < bands.size() - 1; i++) {
-			_eqFrequencyGrid->add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
+			eqFrequencyGrid.add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
 		}
 
-		_equalizerLeft.reset(new orfanidis_eq::eq1(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth));
-		_equalizerRight.reset(new orfanidis_eq::eq1(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth));
-		_equalizerLeft->set_sample_rate(sampleRate);
-		_equalizerRight->set_sample_rate(sampleRate);
+		//Reset all lanes to pass-through sections with no gain (used as padding), and clear the filter state
+		for(FilterSection& s : _sections) {
+			s = {};
+			std::fill(std::begin(s.B[0]), std::end(s.B[0]), 1.0);
+		}
+		std::fill(std::begin(_gains), std::end(_gains), 0.0);
+
+		orfanidis_eq::conversions conv(orfanidis_eq::eq_min_max_gain_db);
+		vector<orfanidis_eq::band_freqs> freqs = eqFrequencyGrid.get_freqs();
+		for(unsigned int i = 0; i < freqs.size() && i < BandCount; i++) {
+			double wb = orfanidis_eq::conversions::hz_2_rad(freqs[i].max_freq - freqs[i].min_freq, sampleRate);
+			double w0 = orfanidis_eq::conversions::hz_2_rad(freqs[i].center_freq, sampleRate);
+
+			SetBandCoefficients(i, w0, wb);
 
-		for(unsigned int i = 0; i < _eqFrequencyGrid->get_number_of_bands(); i++) {
-			_equalizerLeft->change_band_gain_db(i, bandGains[i]);
-			_equalizerRight->change_band_gain_db(i, bandGains[i]);
+			_gains[i] = conv.fast_db_2_lin(bandGains[i]);
+			_gains[i + LanesPerChannel] = _gains[i];
 		}
 
 		_prevSampleRate = sampleRate;
@@ -5,14 +5,33 @@
 class Equalizer
 {
 private:
-	unique_ptr<orfanidis_eq::freq_grid> _eqFrequencyGrid;
-	unique_ptr<orfanidis_eq::eq1> _equalizerLeft;
-	unique_ptr<orfanidis_eq::eq1> _equalizerRight;
+	static constexpr int BandCount = 20;
+	static constexpr int SectionCount = orfanidis_eq::default_eq_band_filters_order / 2;
+
+	//Bands are padded to a multiple of 8 lanes, and both channels are processed at once
+	//(left channel in the first half of the lanes, right channel in the second half)
+	static constexpr int LanesPerChannel = 24;
+	static constexpr int LaneCount = LanesPerChannel * 2;
+
+	//Fourth order section (direct form 1), stored as structure-of-arrays across all bands
+	//The low frequency bands are not stable with single precision, so the filters run in double precision
+	struct FilterSection
+	{
+		alignas(32) double B[5][LaneCount];
+		alignas(32) double A[4][LaneCount];
+		alignas(32) double In[4][LaneCount];
+		alignas(32) double Out[4][LaneCount];
+	};
+
+	FilterSection _sections[SectionCount] = {};
+	alignas(32) double _gains[LaneCount] = {};
 
 	uint32_t _prevSampleRate = 0;
 	vector<double> _prevEqualizerGains;
 
+	void SetBandCoefficients(int band, double w0, double wb);
+
 public:
-	void ApplyEqualizer(uint32_t sampleCount, int16_t *samples);
+	void ApplyEqualizer(uint32_t sampleCount, float *samples);
 	void UpdateEqualizers(vector<double> bandGains, uint32_t sampleRate);
-};
\ No newline at end of file
+};
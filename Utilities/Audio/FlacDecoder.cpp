@@ -0,0 +1,329 @@
+#include "pch.h"
+#include "Utilities/Audio/FlacDecoder.h"
+
+void FlacDecoder::Refill()
+{
+	while(_bitCount <= 56) {
+		uint8_t value = 0;
+		if(_pos < _size) {
+			value = _data[_pos];
+		} else if(_pos >= _size + 16) {
+			//Reading well past the end of the data (e.g in a long run of zeros), stop here
+			_overflow = true;
+		}
+		_pos++;
+		_bitBuffer |= (uint64_t)value << (56 - _bitCount);
+		_bitCount += 8;
+	}
+}
+
+uint32_t FlacDecoder::ReadBits(uint32_t count)
+{
+	if(count == 0) {
+		return 0;
+	}
+	if(_bitCount < count) {
+		Refill();
+	}
+	uint32_t value = (uint32_t)(_bitBuffer >> (64 - count));
+	_bitBuffer <<= count;
+	_bitCount -= count;
+	return value;
+}
+
+int32_t FlacDecoder::ReadSignedBits(uint32_t count)
+{
+	if(count == 0) {
+		return 0;
+	}
+	uint32_t value = ReadBits(count);
+	return (int32_t)(value << (32 - count)) >> (32 - count);
+}
+
+uint32_t FlacDecoder::ReadUnary()
+{
+	uint32_t count = 0;
+	while(!_overflow) {
+		if(_bitCount < 8) {
+			Refill();
+		}
+
+		uint8_t top = (uint8_t)(_bitBuffer >> 56);
+		if(top == 0) {
+			count += 8;
+			_bitBuffer <<= 8;
+			_bitCount -= 8;
+			continue;
+		}
+
+		uint32_t zeros = 0;
+		while(!(top & 0x80)) {
+			top <<= 1;
+			zeros++;
+		}
+		_bitBuffer <<= zeros + 1;
+		_bitCount -= zeros + 1;
+		return count + zeros;
+	}
+	return count;
+}
+
+void FlacDecoder::AlignToByte()
+{
+	ReadBits(_bitCount & 0x07);
+}
+
+size_t FlacDecoder::Decode(const uint8_t* data, size_t size, int16_t* out, uint32_t sampleCount, uint32_t channelCount)
+{
+	_data = data;
+	_size = size;
+	_pos = 0;
+	_bitBuffer = 0;
+	_bitCount = 0;
+	_overflow = false;
+
+	if(channelCount < 1 || channelCount > 2) {
+		return 0;
+	}
+
+	uint32_t decoded = 0;
+	while(decoded < sampleCount) {
+		uint32_t frameSampleCount = 0;
+		if(!DecodeFrame(out + decoded * channelCount, sampleCount - decoded, channelCount, frameSampleCount) || _overflow) {
+			return 0;
+		}
+		decoded += frameSampleCount;
+	}
+
+	size_t consumed = _pos - _bitCount / 8;
+	return consumed <= _size ? consumed : 0;
+}
+
+bool FlacDecoder::DecodeFrame(int16_t* out, uint32_t maxSampleCount, uint32_t channelCount, uint32_t& sampleCount)
+{
+	AlignToByte();
+	if(ReadBits(14) != 0x3FFE) {
+		//Invalid sync code
+		return false;
+	}
+
+	ReadBits(1); //Reserved
+	ReadBits(1); //Blocking strategy
+	uint32_t blockSizeCode = ReadBits(4);
+	uint32_t sampleRateCode = ReadBits(4);
+	uint32_t channelAssignment = ReadBits(4);
+	uint32_t sampleSizeCode = ReadBits(3);
+	ReadBits(1); //Reserved
+
+	//Frame/sample number, coded like UTF-8 characters (value is not needed)
+	uint32_t first = ReadBits(8);
+	for(uint32_t mask = 0x40; (first & 0x80) && (first & mask) && mask > 0x01; mask >>= 1) {
+		ReadBits(8);
+	}
+
+	uint32_t blockSize;
+	if(blockSizeCode == 0) {
+		return false;
+	} else if(blockSizeCode == 1) {
+		blockSize = 192;
+	} else if(blockSizeCode <= 5) {
+		blockSize = 576 << (blockSizeCode - 2);
+	} else if(blockSizeCode == 6) {
+		blockSize = ReadBits(8) + 1;
+	} else if(blockSizeCode == 7) {
+		blockSize = ReadBits(16) + 1;
+	} else {
+		blockSize = 256 << (blockSizeCode - 8);
+	}
+
+	if(sampleRateCode == 12) {
+		ReadBits(8);
+	} else if(sampleRateCode == 13 || sampleRateCode == 14) {
+		ReadBits(16);
+	}
+
+	ReadBits(8); //CRC-8
+
+	if(sampleSizeCode != 0 && sampleSizeCode != 4) {
+		//Only 16-bit samples are supported
+		return false;
+	}
+
+	uint32_t frameChannelCount = channelAssignment < 8 ? channelAssignment + 1 : 2;
+	if(channelAssignment > 10 || frameChannelCount != channelCount || blockSize > FlacDecoder::MaxBlockSize) {
+		return false;
+	}
+
+	for(uint32_t i = 0; i < channelCount; i++) {
+		if(_channels[i].size() < blockSize) {
+			_channels[i].resize(blockSize);
+		}
+
+		//The side channel needs an extra bit
+		bool isSideChannel = (channelAssignment == 8 && i == 1) || (channelAssignment == 9 && i == 0) || (channelAssignment == 10 && i == 1);
+		if(!DecodeSubframe(_channels[i].data(), blockSize, isSideChannel ? 17 : 16)) {
+			return false;
+		}
+	}
+
+	AlignToByte();
+	ReadBits(16); //CRC-16
+
+	sampleCount = std::min(blockSize, maxSampleCount);
+	int32_t* ch0 = _channels[0].data();
+	if(channelCount == 1) {
+		for(uint32_t i = 0; i < sampleCount; i++) {
+			out[i] = (int16_t)ch0[i];
+		}
+		return true;
+	}
+
+	int32_t* ch1 = _channels[1].data();
+	for(uint32_t i = 0; i < sampleCount; i++) {
+		int32_t left;
+		int32_t right;
+		switch(channelAssignment) {
+			case 8: left = ch0[i]; right = ch0[i] - ch1[i]; break;
+			case 9: left = ch0[i] + ch1[i]; right = ch1[i]; break;
+			case 10: {
+				int32_t mid = (ch0[i] << 1) | (ch1[i] & 0x01);
+				left = (mid + ch1[i]) >> 1;
+				right = (mid - ch1[i]) >> 1;
+				break;
+			}
+			default: left = ch0[i]; right = ch1[i]; break;
+		}
+		out[i * 2] = (int16_t)left;
+		out[i * 2 + 1] = (int16_t)right;
+	}
+	return true;
+}
+
+bool FlacDecoder::DecodeSubframe(int32_t* out, uint32_t blockSize, uint32_t bitsPerSample)
+{
+	if(ReadBits(1) != 0) {
+		return false;
+	}
+
+	uint32_t type = ReadBits(6);
+	uint32_t wastedBits = 0;
+	if(ReadBits(1)) {
+		wastedBits = ReadUnary() + 1;
+		if(wastedBits >= bitsPerSample) {
+			return false;
+		}
+		bitsPerSample -= wastedBits;
+	}
+
+	if(type == 0) {
+		//Constant
+		int32_t value = ReadSignedBits(bitsPerSample);
+		for(uint32_t i = 0; i < blockSize; i++) {
+			out[i] = value;
+		}
+	} else if(type == 1) {
+		//Verbatim
+		for(uint32_t i = 0; i < blockSize; i++) {
+			out[i] = ReadSignedBits(bitsPerSample);
+		}
+	} else if(type >= 8 && type <= 12) {
+		//Fixed predictor
+		uint32_t order = type - 8;
+		if(order > blockSize) {
+			return false;
+		}
+		for(uint32_t i = 0; i < order; i++) {
+			out[i] = ReadSignedBits(bitsPerSample);
+		}
+		if(!DecodeResidual(out, blockSize, order)) {
+			return false;
+		}
+
+		switch(order) {
+			case 1: for(uint32_t i = 1; i < blockSize; i++) { out[i] += out[i - 1]; } break;
+			case 2: for(uint32_t i = 2; i < blockSize; i++) { out[i] += 2 * out[i - 1] - out[i - 2]; } break;
+			case 3: for(uint32_t i = 3; i < blockSize; i++) { out[i] += 3 * out[i - 1] - 3 * out[i - 2] + out[i - 3]; } break;
+			case 4: for(uint32_t i = 4; i < blockSize; i++) { out[i] += 4 * out[i - 1] - 6 * out[i - 2] + 4 * out[i - 3] - out[i - 4]; } break;
+		}
+	} else if(type >= 32) {
+		//Linear prediction
+		uint32_t order = type - 31;
+		if(order > blockSize) {
+			return false;
+		}
+		for(uint32_t i = 0; i < order; i++) {
+			out[i] = ReadSignedBits(bitsPerSample);
+		}
+
+		uint32_t precision = ReadBits(4) + 1;
+		int32_t shift = ReadSignedBits(5);
+		if(precision == 16 || shift < 0) {
+			return false;
+		}
+
+		int32_t coefs[32];
+		for(uint32_t i = 0; i < order; i++) {
+			coefs[i] = ReadSignedBits(precision);
+		}
+
+		if(!DecodeResidual(out, blockSize, order)) {
+			return false;
+		}
+
+		for(uint32_t i = order; i < blockSize; i++) {
+			int64_t sum = 0;
+			for(uint32_t j = 0; j < order; j++) {
+				sum += (int64_t)coefs[j] * out[i - 1 - j];
+			}
+			out[i] += (int32_t)(sum >> shift);
+		}
+	} else {
+		//Reserved
+		return false;
+	}
+
+	if(wastedBits) {
+		for(uint32_t i = 0; i < blockSize; i++) {
+			out[i] <<= wastedBits;
+		}
+	}
+	return true;
+}
+
+bool FlacDecoder::DecodeResidual(int32_t* out, uint32_t blockSize, uint32_t predictorOrder)
+{
+	uint32_t method = ReadBits(2);
+	if(method > 1) {
+		return false;
+	}
+
+	uint32_t paramBits = method == 0 ? 4 : 5;
+	uint32_t escapeCode = method == 0 ? 0x0F : 0x1F;
+	uint32_t partitionOrder = ReadBits(4);
+	uint32_t partitionSize = blockSize >> partitionOrder;
+	if((partitionSize << partitionOrder) != blockSize || partitionSize < predictorOrder) {
+		return false;
+	}
+
+	uint32_t pos = predictorOrder;
+	for(uint32_t partition = 0; partition < (1u << partitionOrder); partition++) {
+		uint32_t count = partition == 0 ? partitionSize - predictorOrder : partitionSize;
+		uint32_t param = ReadBits(paramBits);
+		if(param == escapeCode) {
+			uint32_t bits = ReadBits(5);
+			for(uint32_t i = 0; i < count; i++) {
+				out[pos++] = ReadSignedBits(bits);
+			}
+		} else {
+			for(uint32_t i = 0; i < count; i++) {
+				uint32_t value = (ReadUnary() << param) | ReadBits(param);
+				out[pos++] = (int32_t)(value >> 1) ^ -(int32_t)(value & 0x01);
+			}
+		}
+
+		if(_overflow) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "pch.h"
+
+//Decodes raw 16-bit mono/stereo FLAC frames (i.e without the "fLaC" stream header and metadata blocks, as they are stored in CHD files)
+class FlacDecoder
+{
+private:
+	static constexpr uint32_t MaxBlockSize = 65536;
+
+	const uint8_t* _data = nullptr;
+	size_t _size = 0;
+	size_t _pos = 0;
+	uint64_t _bitBuffer = 0;
+	uint32_t _bitCount = 0;
+	bool _overflow = false;
+
+	vector<int32_t> _channels[2];
+
+	__forceinline void Refill();
+	__forceinline uint32_t ReadBits(uint32_t count);
+	__forceinline int32_t ReadSignedBits(uint32_t count);
+	__forceinline uint32_t ReadUnary();
+	void AlignToByte();
+
+	bool DecodeFrame(int16_t* out, uint32_t maxSampleCount, uint32_t channelCount, uint32_t& sampleCount);
+	bool DecodeSubframe(int32_t* out, uint32_t blockSize, uint32_t bitsPerSample);
+	bool DecodeResidual(int32_t* out, uint32_t blockSize, uint32_t predictorOrder);
+
+public:
+	//Decodes "sampleCount" samples (per channel) and writes them interleaved to "out"
+	//Returns the number of bytes consumed from "data" (always a whole number of frames), or 0 if the data is invalid
+	size_t Decode(const uint8_t* data, size_t size, int16_t* out, uint32_t sampleCount, uint32_t channelCount);
+};
@@ -3,27 +3,66 @@
 
 void ReverbFilter::ResetFilter()
 {
-	for(int i = 0; i < 5; i++) {
-		_delay[i].Reset();
-	}
+	_history.clear();
+	_historyPos = 0;
 }
 
-void ReverbFilter::ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay)
+void ReverbFilter::SetParameters(uint32_t sampleRate, double reverbStrength, double reverbDelay)
 {
-	for(int i = 0; i < 2; i++) {
-		_delay[i*5].SetParameters(550 * reverbDelay, 0.25 * reverbStrength, sampleRate);
-		_delay[i*5+1].SetParameters(330 * reverbDelay, 0.15 * reverbStrength, sampleRate);
-		_delay[i*5+2].SetParameters(485 * reverbDelay, 0.12 * reverbStrength, sampleRate);
-		_delay[i*5+3].SetParameters(150 * reverbDelay, 0.20 * reverbStrength, sampleRate);
-		_delay[i*5+4].SetParameters(285 * reverbDelay, 0.05 * reverbStrength, sampleRate);
+	constexpr double delays[DelayCount] = { 550, 330, 485, 150, 285 };
+	constexpr double decays[DelayCount] = { 0.25, 0.15, 0.12, 0.20, 0.05 };
+
+	bool changed = false;
+	for(int i = 0; i < DelayCount; i++) {
+		uint32_t delay = std::max<uint32_t>(1, (uint32_t)(delays[i] * reverbDelay / 1000 * sampleRate));
+		float decay = (float)(decays[i] * reverbStrength);
+		if(delay != _delays[i] || decay != _decay[i]) {
+			_delays[i] = delay;
+			_decay[i] = decay;
+			changed = true;
+		}
 	}
 
-	for(int i = 0; i < 5; i++) {
-		_delay[i].ApplyReverb(stereoBuffer, sampleCount);
-		_delay[i+5].ApplyReverb(stereoBuffer+1, sampleCount);
+	if(changed) {
+		_maxDelay = *std::max_element(std::begin(_delays), std::end(_delays));
+		_minDelay = *std::min_element(std::begin(_delays), std::end(_delays));
+		ResetFilter();
 	}
-	for(int i = 0; i < 5; i++) {
-		_delay[i].AddSamples(stereoBuffer, sampleCount);
-		_delay[i+5].AddSamples(stereoBuffer+1, sampleCount);
+}
+
+void ReverbFilter::ApplyFilter(float* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay)
+{
+	SetParameters(sampleRate, reverbStrength, reverbDelay);
+
+	//The history keeps the last _maxDelay frames, plus room for new samples to avoid moving data on every call
+	uint32_t historyLength = _maxDelay * 2;
+	if(_history.empty()) {
+		_history.resize(historyLength + std::max<uint32_t>(historyLength, 0x4000), 0.0f);
+		_historyPos = historyLength;
 	}
-}
\ No newline at end of file
+
+	//Each comb filter reads its own output from at least _minDelay frames ago, so blocks of up
+	//to _minDelay frames have no dependencies within the block and can be processed with SIMD
+	size_t pos = 0;
+	while(pos < sampleCount) {
+		uint32_t blockSize = (uint32_t)std::min<size_t>(std::min<size_t>(_minDelay, sampleCount - pos), (_history.size() - historyLength) / 2);
+		if(_historyPos + blockSize * 2 > _history.size()) {
+			std::copy(_history.begin() + (_historyPos - historyLength), _history.begin() + _historyPos, _history.begin());
+			_historyPos = historyLength;
+		}
+
+		float* out = stereoBuffer + pos * 2;
+		const float* history = _history.data() + _historyPos;
+		for(int i = 0; i < DelayCount; i++) {
+			const float* delayed = history - _delays[i] * 2;
+			float decay = _decay[i];
+			for(uint32_t j = 0; j < blockSize * 2; j++) {
+				out[j] += delayed[j] * decay;
+			}
+		}
+
+		std::copy(out, out + blockSize * 2, _history.begin() + _historyPos);
+		_historyPos += blockSize * 2;
+		pos += blockSize;
+	}
+}
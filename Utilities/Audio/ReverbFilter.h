@@ -1,56 +1,23 @@
 #pragma once
 #include "pch.h"
-#include <deque>
 
-class ReverbDelay
+class ReverbFilter
 {
 private:
-	std::deque<int16_t> _samples;
-	uint32_t _delay = 0;
-	double _decay = 0;
-
-public:
-	void SetParameters(double delay, double decay, int32_t sampleRate)
-	{
-		uint32_t delaySampleCount = (uint32_t)(delay / 1000 * sampleRate);
-		if(delaySampleCount != _delay || decay != _decay) {
-			_delay = delaySampleCount;
-			_decay = decay;
-			_samples.clear();
-		}
-	}
-
-	void Reset()
-	{
-		_samples.clear();
-	}
-
-	void AddSamples(int16_t* buffer, size_t sampleCount)
-	{
-		for(size_t i = 0; i < sampleCount; i++) {
-			_samples.push_back(buffer[i*2]);
-		}
-	}
+	static constexpr int DelayCount = 5;
 
-	void ApplyReverb(int16_t* buffer, size_t sampleCount)
-	{
-		if(_samples.size() > _delay) {
-			size_t samplesToInsert = std::min<size_t>(_samples.size() - _delay, sampleCount);
+	//Interleaved stereo history of the filter's output, the most recent sample is at _historyPos - 1
+	vector<float> _history;
+	uint32_t _historyPos = 0;
 
-			for(size_t j = sampleCount - samplesToInsert; j < sampleCount; j++) {
-				buffer[j*2] += (int16_t)((double)_samples.front() * _decay);
-				_samples.pop_front();
-			}
-		}
-	}
-};
+	uint32_t _delays[DelayCount] = {};
+	float _decay[DelayCount] = {};
+	uint32_t _maxDelay = 0;
+	uint32_t _minDelay = 0;
 
-class ReverbFilter
-{
-private:
-	ReverbDelay _delay[10];
+	void SetParameters(uint32_t sampleRate, double reverbStrength, double reverbDelay);
 
 public:
 	void ResetFilter();
-	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay);
-};
\ No newline at end of file
+	void ApplyFilter(float* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay);
+};
@@ -0,0 +1,172 @@
+#include "pch.h"
+#include "SincResampler.h"
+#include <cmath>
+
+SincResampler::SincResampler()
+{
+	SetQuality(SincResamplerQuality::Low);
+}
+
+void SincResampler::Reset()
+{
+	_samples.clear();
+	_position = 0;
+}
+
+void SincResampler::SetQuality(SincResamplerQuality quality)
+{
+	if(quality == _quality && !_coefficients.empty()) {
+		return;
+	}
+
+	_quality = quality;
+	switch(quality) {
+		default:
+		case SincResamplerQuality::Low: _baseTapCount = 8; _phaseCount = 64; _interpolatePhases = false; _rolloff = 0.80; break;
+		case SincResamplerQuality::Medium: _baseTapCount = 16; _phaseCount = 256; _interpolatePhases = false; _rolloff = 0.90; break;
+		case SincResamplerQuality::High: _baseTapCount = 32; _phaseCount = 256; _interpolatePhases = true; _rolloff = 0.94; break;
+	}
+
+	Reset();
+	UpdateCoefficients();
+}
+
+void SincResampler::SetSampleRates(double srcRate, double dstRate)
+{
+	_rateRatio = srcRate / dstRate;
+
+	//Only recalculate the filter when the cutoff frequency changes significantly, the small
+	//adjustments made by the dynamic sample rate don't need a new table
+	double cutoff = std::min(1.0, 1.0 / _rateRatio) * _rolloff;
+	if(std::abs(cutoff - _cutoff) > _cutoff * 0.01) {
+		UpdateCoefficients();
+	}
+}
+
+void SincResampler::UpdateCoefficients()
+{
+	constexpr double pi = 3.14159265358979323846;
+
+	double scale = std::min(1.0, 1.0 / _rateRatio);
+	_cutoff = scale * _rolloff;
+
+	//When downsampling, the filter needs to be proportionally longer to keep the same transition band (in output samples)
+	uint32_t tapCount = (uint32_t)std::ceil(_baseTapCount / scale);
+	tapCount = std::min(MaxTapCount, (tapCount + 7) & ~7);
+	if(tapCount != _tapCount) {
+		_tapCount = tapCount;
+		Reset();
+	}
+
+	_coefficients.resize((_phaseCount + 1) * _tapCount * 2);
+	_interpolated.resize(_tapCount * 2);
+
+	double halfWidth = _tapCount / 2.0;
+	vector<double> row(_tapCount);
+	for(uint32_t phase = 0; phase <= _phaseCount; phase++) {
+		double fraction = (double)phase / _phaseCount;
+
+		double sum = 0;
+		for(uint32_t i = 0; i < _tapCount; i++) {
+			//Distance between this tap and the output sample's position (which is between taps N/2-1 and N/2)
+			double x = (double)i - (halfWidth - 1) - fraction;
+			double sinc = x == 0 ? 1.0 : std::sin(pi * _cutoff * x) / (pi * _cutoff * x);
+
+			//Blackman window
+			double n = (x + halfWidth) / (2 * halfWidth);
+			double window = n <= 0 || n >= 1 ? 0.0 : (0.42 - 0.5 * std::cos(2 * pi * n) + 0.08 * std::cos(4 * pi * n));
+
+			row[i] = sinc * window;
+			sum += row[i];
+		}
+
+		//Normalize each phase to unity gain
+		float* coefficients = _coefficients.data() + phase * _tapCount * 2;
+		for(uint32_t i = 0; i < _tapCount; i++) {
+			coefficients[i * 2] = (float)(row[i] / sum);
+			coefficients[i * 2 + 1] = coefficients[i * 2];
+		}
+	}
+}
+
+template<bool interpolatePhases>
+uint32_t SincResampler::ProcessSamples(int16_t* out)
+{
+	//Use a compile-time tap count, which lets the compiler fully unroll and vectorize the dot product
+	switch(_tapCount) {
+		case 8: return ProcessSamples<interpolatePhases, 8>(out);
+		case 16: return ProcessSamples<interpolatePhases, 16>(out);
+		case 24: return ProcessSamples<interpolatePhases, 24>(out);
+		case 32: return ProcessSamples<interpolatePhases, 32>(out);
+		case 40: return ProcessSamples<interpolatePhases, 40>(out);
+		case 48: return ProcessSamples<interpolatePhases, 48>(out);
+		case 56: return ProcessSamples<interpolatePhases, 56>(out);
+		default: return ProcessSamples<interpolatePhases, 64>(out);
+	}
+}
+
+template<bool interpolatePhases, uint32_t tapCount>
+uint32_t SincResampler::ProcessSamples(int16_t* out)
+{
+	constexpr uint32_t rowSize = tapCount * 2;
+	size_t available = _samples.size() / 2;
+	uint32_t outPos = 0;
+	while(true) {
+		size_t offset = (size_t)_position;
+		if(offset + tapCount > available) {
+			break;
+		}
+
+		double phasePos = (_position - offset) * _phaseCount;
+		uint32_t phase = (uint32_t)phasePos;
+		const float* coefficients = _coefficients.data() + phase * rowSize;
+		if constexpr(interpolatePhases) {
+			//Linear interpolation between the 2 nearest phases
+			float mu = (float)(phasePos - phase);
+			const float* next = coefficients + rowSize;
+			for(uint32_t i = 0; i < rowSize; i++) {
+				_interpolated[i] = coefficients[i] + (next[i] - coefficients[i]) * mu;
+			}
+			coefficients = _interpolated.data();
+		}
+
+		//Accumulate in 8 lanes (even lanes for the left channel, odd lanes for the right channel)
+		//to allow the compiler to vectorize the dot product
+		alignas(32) float acc[8] = {};
+		const float* in = _samples.data() + offset * 2;
+		for(uint32_t i = 0; i < rowSize; i += 8) {
+			for(int j = 0; j < 8; j++) {
+				acc[j] += in[i + j] * coefficients[i + j];
+			}
+		}
+
+		float left = (acc[0] + acc[2]) + (acc[4] + acc[6]);
+		float right = (acc[1] + acc[3]) + (acc[5] + acc[7]);
+		out[outPos] = (int16_t)std::clamp(left, -32768.0f, 32767.0f);
+		out[outPos + 1] = (int16_t)std::clamp(right, -32768.0f, 32767.0f);
+		outPos += 2;
+
+		_position += _rateRatio;
+	}
+
+	return outPos / 2;
+}
+
+uint32_t SincResampler::Resample(int16_t* in, uint32_t inSampleCount, int16_t* out)
+{
+	size_t prevSize = _samples.size();
+	_samples.resize(prevSize + inSampleCount * 2);
+	float* samples = _samples.data() + prevSize;
+	for(uint32_t i = 0; i < inSampleCount * 2; i++) {
+		samples[i] = in[i];
+	}
+
+	uint32_t count = _interpolatePhases ? ProcessSamples<true>(out) : ProcessSamples<false>(out);
+
+	//Drop the input samples that are no longer needed
+	size_t consumed = std::min((size_t)_position, _samples.size() / 2);
+	_samples.erase(_samples.begin(), _samples.begin() + consumed * 2);
+	_position -= consumed;
+
+	return count;
+}
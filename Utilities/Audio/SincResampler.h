@@ -0,0 +1,55 @@
+#pragma once
+#include "pch.h"
+
+enum class SincResamplerQuality
+{
+	Low,
+	Medium,
+	High
+};
+
+//Windowed-sinc polyphase resampler
+//The filter's coefficients are precomputed for every phase, and each output sample is a
+//dot product of the input samples around it with one phase's coefficients.
+class SincResampler
+{
+private:
+	static constexpr uint32_t MaxTapCount = 64;
+
+	SincResamplerQuality _quality = SincResamplerQuality::Low;
+	uint32_t _baseTapCount = 0;
+	uint32_t _phaseCount = 0;
+	bool _interpolatePhases = false;
+	double _rolloff = 0;
+
+	double _rateRatio = 1.0;
+	double _cutoff = 0;
+	uint32_t _tapCount = 0;
+
+	//(_phaseCount + 1) rows of _tapCount coefficients, each coefficient is stored twice
+	//(once for each channel) to match the layout of the interleaved input samples
+	vector<float> _coefficients;
+	vector<float> _interpolated;
+
+	//Pending input samples (interleaved stereo), _position is the position of the next output sample
+	vector<float> _samples;
+	double _position = 0;
+
+	void UpdateCoefficients();
+
+	template<bool interpolatePhases>
+	uint32_t ProcessSamples(int16_t* out);
+
+	template<bool interpolatePhases, uint32_t tapCount>
+	uint32_t ProcessSamples(int16_t* out);
+
+public:
+	SincResampler();
+
+	void Reset();
+
+	void SetQuality(SincResamplerQuality quality);
+	void SetSampleRates(double srcRate, double dstRate);
+
+	uint32_t Resample(int16_t* in, uint32_t inSampleCount, int16_t* out);
+};
@@ -0,0 +1,220 @@
+#include "pch.h"
+#include <chrono>
+#include "Utilities/MemoryMappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::MemoryMappedFile()
+{
+	_stopReadAhead = false;
+	_readAheadRequested = false;
+	_readPosition = 0;
+	_warmedEnd = 0;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+	if(_readAheadThread.joinable()) {
+		_stopReadAhead = true;
+		_readAheadSignal.Signal();
+		_readAheadThread.join();
+	}
+	Close();
+}
+
+bool MemoryMappedFile::Open(const string& filename)
+{
+	Close();
+
+	uint8_t* data = nullptr;
+	size_t size = 0;
+
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileW(utf8::utf8::decode(filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if(fileHandle == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER fileSize = {};
+	HANDLE mappingHandle = nullptr;
+	if(GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0) {
+		mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(mappingHandle) {
+			data = (uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+			size = (size_t)fileSize.QuadPart;
+		}
+	}
+
+	if(!data) {
+		if(mappingHandle) {
+			CloseHandle(mappingHandle);
+		}
+		CloseHandle(fileHandle);
+		return false;
+	}
+#else
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return false;
+	}
+
+	struct stat fileInfo = {};
+	if(fstat(fd, &fileInfo) == 0 && fileInfo.st_size > 0) {
+		void* mapping = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(mapping != MAP_FAILED) {
+			data = (uint8_t*)mapping;
+			size = (size_t)fileInfo.st_size;
+		}
+	}
+
+	//The mapping stays valid after the file descriptor is closed
+	close(fd);
+	if(!data) {
+		return false;
+	}
+#endif
+
+	auto lock = _mappingLock.AcquireSafe();
+#ifdef _WIN32
+	_fileHandle = fileHandle;
+	_mappingHandle = mappingHandle;
+#endif
+	_data = data;
+	_size = size;
+	_readPosition = 0;
+	_warmedEnd = 0;
+	if(_readAheadSize) {
+		DisableKernelReadAhead();
+	}
+	return true;
+}
+
+void MemoryMappedFile::DisableKernelReadAhead()
+{
+#ifndef _WIN32
+	//Keep page faults on the reading thread as small as possible, the read-ahead thread takes care of loading the rest
+	madvise(_data, _size, MADV_RANDOM);
+#endif
+}
+
+void MemoryMappedFile::Close()
+{
+	//Wait for the read-ahead thread to be done with the current chunk before unmapping
+	auto lock = _mappingLock.AcquireSafe();
+	if(_data) {
+#ifdef _WIN32
+		UnmapViewOfFile(_data);
+		CloseHandle((HANDLE)_mappingHandle);
+		CloseHandle((HANDLE)_fileHandle);
+		_mappingHandle = nullptr;
+		_fileHandle = nullptr;
+#else
+		munmap(_data, _size);
+#endif
+		_data = nullptr;
+		_size = 0;
+	}
+}
+
+void MemoryMappedFile::EnableReadAhead(size_t windowSize)
+{
+	if(!_readAheadThread.joinable()) {
+		_readAheadSize = windowSize;
+		if(_data) {
+			DisableKernelReadAhead();
+		}
+		_readAheadThread = std::thread(&MemoryMappedFile::ReadAheadThread, this);
+	}
+}
+
+void MemoryMappedFile::Seek(size_t offset)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+
+	_warmedEnd = offset;
+	_readPosition = offset;
+	if(offset < _size) {
+		volatile uint8_t value = _data[offset];
+		(void)value;
+	}
+
+	double latencyUs = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+	_seekStats.SeekCount++;
+	_seekStats.TotalLatencyUs += latencyUs;
+	if(latencyUs > _seekStats.MaxLatencyUs) {
+		_seekStats.MaxLatencyUs = latencyUs;
+	}
+
+	UpdateReadPosition(offset);
+}
+
+MappedFileSeekStats MemoryMappedFile::TakeSeekStats()
+{
+	MappedFileSeekStats stats = _seekStats;
+	_seekStats = {};
+	return stats;
+}
+
+void MemoryMappedFile::ReadAheadThread()
+{
+	while(!_stopReadAhead) {
+		_readAheadSignal.Wait(100);
+		_readAheadRequested = false;
+
+		while(!_stopReadAhead) {
+			size_t position = _readPosition.load(std::memory_order_relaxed);
+			size_t warmedEnd = _warmedEnd.load(std::memory_order_relaxed);
+			if(warmedEnd == SIZE_MAX) {
+				//Everything up to the end of the file is already loaded
+				break;
+			}
+
+			//Start from the end of the previously warmed range, unless the read position jumped past it
+			size_t start = (warmedEnd > position && warmedEnd <= position + _readAheadSize) ? warmedEnd : position;
+			size_t end = start + ReadAheadChunkSize;
+			if(end > position + _readAheadSize) {
+				end = position + _readAheadSize;
+			}
+			if(start >= end) {
+				break;
+			}
+
+			size_t newWarmedEnd = WarmRange(start, end);
+			if(newWarmedEnd == 0) {
+				break;
+			}
+
+			//A seek resets _warmedEnd - don't overwrite it in that case
+			_warmedEnd.compare_exchange_strong(warmedEnd, newWarmedEnd);
+		}
+	}
+}
+
+size_t MemoryMappedFile::WarmRange(size_t start, size_t end)
+{
+	auto lock = _mappingLock.AcquireSafe();
+	if(!_data || start >= _size) {
+		return 0;
+	}
+
+	size_t alignedStart = start & ~(PageSize - 1);
+#ifndef _WIN32
+	madvise(_data + alignedStart, std::min(end, _size) - alignedStart, MADV_WILLNEED);
+#endif
+
+	volatile uint8_t value = 0;
+	for(size_t offset = alignedStart; offset < end && offset < _size; offset += PageSize) {
+		value = _data[offset];
+	}
+	(void)value;
+
+	//Once the end of the file is reached, there is nothing left to warm until the next seek
+	return end >= _size ? SIZE_MAX : end;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+
+struct MappedFileSeekStats
+{
+	uint32_t SeekCount = 0;
+	double TotalLatencyUs = 0;
+	double MaxLatencyUs = 0;
+};
+
+//Read-only memory mapped file, with an optional background thread that touches the pages
+//ahead of the current read position so the reading thread doesn't block on disk I/O
+class MemoryMappedFile
+{
+private:
+	static constexpr size_t PageSize = 0x1000;
+	static constexpr size_t ReadAheadChunkSize = 0x10000;
+
+	uint8_t* _data = nullptr;
+	size_t _size = 0;
+
+#ifdef _WIN32
+	void* _fileHandle = nullptr;
+	void* _mappingHandle = nullptr;
+#endif
+
+	MappedFileSeekStats _seekStats = {};
+
+	std::thread _readAheadThread;
+	AutoResetEvent _readAheadSignal;
+	SimpleLock _mappingLock;
+	atomic<bool> _stopReadAhead;
+	atomic<bool> _readAheadRequested;
+	atomic<size_t> _readPosition;
+	atomic<size_t> _warmedEnd;
+	size_t _readAheadSize = 0;
+
+	void ReadAheadThread();
+	void DisableKernelReadAhead();
+	size_t WarmRange(size_t start, size_t end);
+
+public:
+	MemoryMappedFile();
+	~MemoryMappedFile();
+
+	bool Open(const string& filename);
+	void Close();
+
+	bool IsOpen() { return _data != nullptr; }
+	const uint8_t* GetData() { return _data; }
+	size_t GetSize() { return _size; }
+
+	//Starts a thread that keeps the next "windowSize" bytes after the read position in memory
+	void EnableReadAhead(size_t windowSize);
+
+	//Moves the read position, faulting in the target page immediately (the time this takes is recorded in the seek stats)
+	void Seek(size_t offset);
+
+	//Lets the read-ahead thread know the read position moved forward (cheap enough to call on every read)
+	__forceinline void UpdateReadPosition(size_t offset)
+	{
+		_readPosition.store(offset, std::memory_order_relaxed);
+		if(_readAheadSize && offset + _readAheadSize / 2 > _warmedEnd.load(std::memory_order_relaxed) && !_readAheadRequested.exchange(true)) {
+			_readAheadSignal.Signal();
+		}
+	}
+
+	//Returns the seek stats accumulated since the last call
+	MappedFileSeekStats TakeSeekStats();
+};
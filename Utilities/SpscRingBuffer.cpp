@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "SpscRingBuffer.h"
+
+SpscRingBuffer::SpscRingBuffer()
+{
+	Clear();
+}
+
+SpscRingBuffer::~SpscRingBuffer()
+{
+	delete[] _buffer;
+}
+
+void SpscRingBuffer::Resize(uint32_t size, uint32_t blockSize)
+{
+	delete[] _buffer;
+	_blockSize = blockSize;
+	_size = size - (size % blockSize);
+	_buffer = new uint8_t[_size];
+	memset(_buffer, 0, _size);
+	Clear();
+}
+
+void SpscRingBuffer::Clear()
+{
+	_underrunCount.store(0, std::memory_order_relaxed);
+	_overrunCount.store(0, std::memory_order_relaxed);
+	_writeIndex.store(0, std::memory_order_release);
+	_readIndex.store(0, std::memory_order_release);
+}
+
+uint32_t SpscRingBuffer::GetSize()
+{
+	return _size;
+}
+
+uint32_t SpscRingBuffer::GetFillLevel()
+{
+	uint64_t readIndex = _readIndex.load(std::memory_order_acquire);
+	uint64_t writeIndex = _writeIndex.load(std::memory_order_acquire);
+	return writeIndex > readIndex ? (uint32_t)(writeIndex - readIndex) : 0;
+}
+
+uint32_t SpscRingBuffer::GetUnderrunCount()
+{
+	return _underrunCount.load(std::memory_order_relaxed);
+}
+
+uint32_t SpscRingBuffer::GetOverrunCount()
+{
+	return _overrunCount.load(std::memory_order_relaxed);
+}
+
+uint32_t SpscRingBuffer::Write(const uint8_t* data, uint32_t length)
+{
+	if(_size == 0) {
+		return 0;
+	}
+
+	uint64_t writeIndex = _writeIndex.load(std::memory_order_relaxed);
+	uint64_t readIndex = _readIndex.load(std::memory_order_acquire);
+
+	uint32_t freeSpace = _size - (uint32_t)(writeIndex - readIndex);
+	uint32_t count = std::min(length, freeSpace - (freeSpace % _blockSize));
+	if(count < length) {
+		_overrunCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint32_t pos = (uint32_t)(writeIndex % _size);
+	uint32_t firstPart = std::min(count, _size - pos);
+	memcpy(_buffer + pos, data, firstPart);
+	memcpy(_buffer, data + firstPart, count - firstPart);
+
+	//Publish the new data to the consumer
+	_writeIndex.store(writeIndex + count, std::memory_order_release);
+	return count;
+}
+
+uint32_t SpscRingBuffer::Read(uint8_t* output, uint32_t length)
+{
+	if(_size == 0) {
+		return 0;
+	}
+
+	uint64_t readIndex = _readIndex.load(std::memory_order_relaxed);
+	uint64_t writeIndex = _writeIndex.load(std::memory_order_acquire);
+
+	uint32_t available = (uint32_t)(writeIndex - readIndex);
+	uint32_t count = std::min(length, available - (available % _blockSize));
+	if(count < length) {
+		_underrunCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint32_t pos = (uint32_t)(readIndex % _size);
+	uint32_t firstPart = std::min(count, _size - pos);
+	memcpy(output, _buffer + pos, firstPart);
+	memcpy(output + firstPart, _buffer, count - firstPart);
+
+	//Release the space back to the producer
+	_readIndex.store(readIndex + count, std::memory_order_release);
+	return count;
+}
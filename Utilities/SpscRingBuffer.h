@@ -0,0 +1,39 @@
+#pragma once
+#include "pch.h"
+
+//Lock-free ring buffer for a single producer thread and a single consumer thread
+//Reads and writes are always done in multiples of the block size (e.g 4 bytes for 16-bit stereo samples)
+class SpscRingBuffer
+{
+private:
+	uint8_t* _buffer = nullptr;
+	uint32_t _size = 0;
+	uint32_t _blockSize = 1;
+
+	//Total number of bytes written/read since the last reset (the position in the buffer is index % size)
+	//Each index is only modified by its owner thread, and kept on separate cache lines
+	alignas(64) atomic<uint64_t> _writeIndex;
+	alignas(64) atomic<uint64_t> _readIndex;
+
+	atomic<uint32_t> _underrunCount;
+	atomic<uint32_t> _overrunCount;
+
+public:
+	SpscRingBuffer();
+	~SpscRingBuffer();
+
+	//Resize & Clear must not be called while the consumer or producer may be using the buffer
+	void Resize(uint32_t size, uint32_t blockSize);
+	void Clear();
+
+	uint32_t GetSize();
+	uint32_t GetFillLevel();
+	uint32_t GetUnderrunCount();
+	uint32_t GetOverrunCount();
+
+	//Producer thread only - returns the number of bytes written, data that doesn't fit is dropped
+	uint32_t Write(const uint8_t* data, uint32_t length);
+
+	//Consumer thread only - returns the number of bytes read
+	uint32_t Read(uint8_t* output, uint32_t length);
+};
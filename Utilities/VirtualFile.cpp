@@ -10,12 +10,13 @@
 #include "Utilities/Patches/IpsPatcher.h"
 #include "Utilities/Patches/UpsPatcher.h"
 #include "Utilities/CRC32.h"
+#include "Utilities/MemoryMappedFile.h"
 
 const std::initializer_list<string> VirtualFile::RomExtensions = {
 	".nes", ".fds", ".unif", ".unf", ".nsf", ".nsfe", ".studybox",
 	".sfc", ".swc", ".fig", ".smc", ".bs", ".spc",
 	".gb", ".gbc", ".gbs",
-	".pce", ".cue", ".hes"
+	".pce", ".cue", ".chd", ".hes"
 };
 
 VirtualFile::VirtualFile()
@@ -83,7 +84,7 @@ void VirtualFile::FromStream(std::istream& input, vector<uint8_t>& output)
 
 void VirtualFile::LoadFile()
 {
-	if(_data.size() == 0) {
+	if(_data.size() == 0 && !_mappedFile) {
 		if(!_innerFile.empty()) {
 			unique_ptr<ArchiveReader> reader = ArchiveReader::GetReader(_path);
 			if(reader) {
@@ -105,9 +106,53 @@ void VirtualFile::LoadFile()
 	}
 }
 
+void VirtualFile::MapFile()
+{
+	if(_data.size() == 0 && !_mappedFile && _innerFile.empty()) {
+		shared_ptr<MemoryMappedFile> file(new MemoryMappedFile());
+		if(file->Open(_path) && file->GetSize() >= VirtualFile::MinMappedFileSize) {
+			_mappedFile = file;
+		}
+	}
+	LoadFile();
+}
+
+template<typename T>
+void VirtualFile::ProcessData(T callback)
+{
+	if(_data.size() == 0 && !_mappedFile && _innerFile.empty()) {
+		//Large files are only mapped for the duration of the call, to avoid copying them twice
+		//without keeping them mapped (and locked, on Windows) after they are loaded or hashed
+		MemoryMappedFile file;
+		if(file.Open(_path) && file.GetSize() >= VirtualFile::MinMappedFileSize) {
+			callback(file.GetData(), file.GetSize());
+			return;
+		}
+	}
+
+	LoadFile();
+	if(_mappedFile) {
+		callback(_mappedFile->GetData(), _mappedFile->GetSize());
+	} else {
+		callback(_data.data(), _data.size());
+	}
+}
+
+const uint8_t* VirtualFile::GetData()
+{
+	MapFile();
+	return _mappedFile ? _mappedFile->GetData() : _data.data();
+}
+
+size_t VirtualFile::GetDataSize()
+{
+	MapFile();
+	return _mappedFile ? _mappedFile->GetSize() : _data.size();
+}
+
 bool VirtualFile::IsValid()
 {
-	if(_data.size() > 0) {
+	if(_data.size() > 0 || _mappedFile) {
 		return true;
 	}
 
@@ -159,19 +204,27 @@ string VirtualFile::GetFileExtension()
 
 string VirtualFile::GetSha1Hash()
 {
-	LoadFile();
-	return SHA1::GetHash(_data);
+	string hash;
+	ProcessData([&](const uint8_t* data, size_t size) {
+		hash = SHA1::GetHash((uint8_t*)data, size);
+	});
+	return hash;
 }
 
 uint32_t VirtualFile::GetCrc32()
 {
-	LoadFile();
-	return CRC32::GetCRC(_data);
+	uint32_t crc = 0;
+	ProcessData([&](const uint8_t* data, size_t size) {
+		crc = CRC32::GetCRC((uint8_t*)data, size);
+	});
+	return crc;
 }
 
 size_t VirtualFile::GetSize()
 {
-	if(_data.size() > 0) {
+	if(_mappedFile) {
+		return _mappedFile->GetSize();
+	} else if(_data.size() > 0) {
 		return _data.size();
 	} else {
 		if(_fileSize >= 0) {
@@ -195,7 +248,9 @@ bool VirtualFile::CheckFileSignature(vector<string> signatures, bool loadArchive
 {
 	vector<uint8_t> partialData;
 
-	if(_data.empty()) {
+	if(_mappedFile) {
+		partialData.assign(_mappedFile->GetData(), _mappedFile->GetData() + std::min<size_t>(_mappedFile->GetSize(), 512));
+	} else if(_data.empty()) {
 		if(loadArchives) {
 			LoadFile();
 		} else {
@@ -224,63 +279,50 @@ bool VirtualFile::CheckFileSignature(vector<string> signatures, bool loadArchive
 	return false;
 }
 
-void VirtualFile::InitChunks()
-{
-	if(!_useChunks) {
-		_useChunks = true;
-		_chunks.resize(GetSize() / VirtualFile::ChunkSize + 1);
-	}
-}
-
 bool VirtualFile::ReadFile(vector<uint8_t>& out)
 {
-	LoadFile();
-	if(_data.size() > 0) {
-		out.resize(_data.size(), 0);
-		std::copy(_data.begin(), _data.end(), out.begin());
-		return true;
-	}
-	return false;
+	bool result = false;
+	ProcessData([&](const uint8_t* data, size_t size) {
+		if(size > 0) {
+			out.assign(data, data + size);
+			result = true;
+		}
+	});
+	return result;
 }
 
 bool VirtualFile::ReadFile(std::stringstream& out)
 {
-	LoadFile();
-	if(_data.size() > 0) {
-		out.write((char*)_data.data(), _data.size());
-		return true;
-	}
-	return false;
+	bool result = false;
+	ProcessData([&](const uint8_t* data, size_t size) {
+		if(size > 0) {
+			out.write((char*)data, size);
+			result = true;
+		}
+	});
+	return result;
 }
 
 bool VirtualFile::ReadFile(uint8_t* out, uint32_t expectedSize)
 {
-	LoadFile();
-	if(_data.size() == expectedSize) {
-		memcpy(out, _data.data(), _data.size());
-		return true;
-	}
-	return false;
+	bool result = false;
+	ProcessData([&](const uint8_t* data, size_t size) {
+		if(size == expectedSize) {
+			memcpy(out, data, size);
+			result = true;
+		}
+	});
+	return result;
 }
 
 uint8_t VirtualFile::ReadByte(uint32_t offset)
 {
-	InitChunks();
-	if(offset < 0 || offset > GetSize()) {
+	const uint8_t* data = GetData();
+	if(offset >= GetDataSize()) {
 		//Out of bounds
 		return 0;
 	}
-
-	uint32_t chunkId = offset / VirtualFile::ChunkSize;
-	uint32_t chunkStart = chunkId * VirtualFile::ChunkSize;
-	if(_chunks[chunkId].size() == 0) {
-		ifstream input(_path, std::ios::in | std::ios::binary);
-		input.seekg(chunkStart, std::ios::beg);
-
-		_chunks[chunkId].resize(VirtualFile::ChunkSize);
-		input.read((char*)_chunks[chunkId].data(), VirtualFile::ChunkSize);
-	}
-	return _chunks[chunkId][offset - chunkStart];
+	return data[offset];
 }
 
 bool VirtualFile::ApplyPatch(VirtualFile& patch)
@@ -291,19 +333,27 @@ bool VirtualFile::ApplyPatch(VirtualFile& patch)
 		patch.LoadFile();
 		LoadFile();
 		if(patch._data.size() >= 5) {
+			//The patchers need a copy of the original data when the file is memory mapped
+			vector<uint8_t> mappedData;
+			if(_mappedFile) {
+				ReadFile(mappedData);
+			}
+			vector<uint8_t>& input = _mappedFile ? mappedData : _data;
+
 			vector<uint8_t> patchedData;
 			std::stringstream ss;
 			patch.ReadFile(ss);
 
 			if(memcmp(patch._data.data(), "PATCH", 5) == 0) {
-				result = IpsPatcher::PatchBuffer(ss, _data, patchedData);
+				result = IpsPatcher::PatchBuffer(ss, input, patchedData);
 			} else if(memcmp(patch._data.data(), "UPS1", 4) == 0) {
-				result = UpsPatcher::PatchBuffer(ss, _data, patchedData);
+				result = UpsPatcher::PatchBuffer(ss, input, patchedData);
 			} else if(memcmp(patch._data.data(), "BPS1", 4) == 0) {
-				result = BpsPatcher::PatchBuffer(ss, _data, patchedData);
+				result = BpsPatcher::PatchBuffer(ss, input, patchedData);
 			}
 			if(result) {
-				_data = patchedData;
+				_data = std::move(patchedData);
+				_mappedFile.reset();
 			}
 		}
 	}
@@ -2,10 +2,13 @@
 #include "pch.h"
 #include <sstream>
 
+class MemoryMappedFile;
+
 class VirtualFile
 {
 private:
-	constexpr static int ChunkSize = 256 * 1024;
+	//Random access to smaller files (and archives) loads them in memory, larger files are memory mapped instead
+	constexpr static size_t MinMappedFileSize = 1024 * 1024;
 
 	string _path = "";
 	string _innerFile = "";
@@ -13,12 +16,18 @@ private:
 	vector<uint8_t> _data;
 	int64_t _fileSize = -1;
 
-	vector<vector<uint8_t>> _chunks;
-	bool _useChunks = false;
+	//Read-only mapping used by GetData/ReadByte/ReadChunk (e.g CD images, MSU-1 data), shared between copies
+	//Whole-file reads and hashing don't create it. It is replaced by a copy in _data when a patch is applied
+	shared_ptr<MemoryMappedFile> _mappedFile;
 
 	void FromStream(std::istream &input, vector<uint8_t> &output);
 
 	void LoadFile();
+	void MapFile();
+	size_t GetDataSize();
+
+	template<typename T>
+	void ProcessData(T callback);
 
 public:
 	static const std::initializer_list<string> RomExtensions;
@@ -42,7 +51,10 @@ public:
 
 	size_t GetSize();
 	bool CheckFileSignature(vector<string> signatures, bool loadArchives = false);
-	void InitChunks();
+
+	//Returns the file's content for random access, without copying large files (they stay memory mapped)
+	//The pointer stays valid until this VirtualFile (and its copies) are destroyed or patched
+	const uint8_t* GetData();
 
 	bool ReadFile(vector<uint8_t> &out);
 	bool ReadFile(std::stringstream &out);
@@ -55,16 +67,13 @@ public:
 	template<typename T>
 	bool ReadChunk(T& container, int start, int length)
 	{
-		InitChunks();
-		if(start < 0 || start + length > GetSize()) {
+		const uint8_t* data = GetData();
+		if(start < 0 || start + length > GetDataSize()) {
 			//Out of bounds
 			return false;
 		}
 
-		for(int i = start, end = start + length; i < end; i++) {
-			container.push_back(ReadByte(i));
-		}
-
+		container.insert(container.end(), data + start, data + start + length);
 		return true;
 	}
 };
\ No newline at end of file
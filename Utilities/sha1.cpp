@@ -249,6 +249,26 @@ void SHA1::update(std::istream &is)
 }
 
 
+void SHA1::update(const uint8_t* data, size_t size)
+{
+	uint32_t block[BLOCK_INTS];
+
+	while(size > 0) {
+		size_t length = std::min<size_t>(BLOCK_BYTES - buffer.size(), size);
+		buffer.append((const char*)data, length);
+		data += length;
+		size -= length;
+		if(buffer.size() != BLOCK_BYTES) {
+			return;
+		}
+
+		buffer_to_block(buffer, block);
+		transform(digest, block, transforms);
+		buffer.clear();
+	}
+}
+
+
 /*
  * Add padding and return the message digest.
  */
@@ -295,21 +315,13 @@ std::string SHA1::final()
 
 std::string SHA1::GetHash(vector<uint8_t> &data)
 {
-	std::stringstream ss;
-	ss.write((char*)data.data(), data.size());
-	
-	SHA1 checksum;
-	checksum.update(ss);
-	return checksum.final();
+	return GetHash(data.data(), data.size());
 }
 
 std::string SHA1::GetHash(uint8_t* data, size_t size)
 {
-	std::stringstream ss;
-	ss.write((char*)data, size);
-
 	SHA1 checksum;
-	checksum.update(ss);
+	checksum.update(data, size);
 	return checksum.final();
 }
 
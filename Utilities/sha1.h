@@ -29,6 +29,7 @@ public:
     SHA1();
     void update(const std::string &s);
     void update(std::istream &is);
+    void update(const uint8_t* data, size_t size);
     std::string final();
     static std::string GetHash(const std::string &filename);
 	 static std::string GetHash(std::istream &stream);